@@ -16,6 +16,17 @@
 #include <NCollection_IncAllocator.hxx>
 
 #include <algorithm>
+#include <cstring>
+
+// software prefetch hint used to overlap bucket fetches of consecutive map lookups
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  #include <xmmintrin.h>
+  #define Poly_MergeNodesTool_Prefetch(thePtr) _mm_prefetch ((const char* )(thePtr), _MM_HINT_T0)
+#elif defined(__GNUC__)
+  #define Poly_MergeNodesTool_Prefetch(thePtr) __builtin_prefetch (thePtr)
+#else
+  #define Poly_MergeNodesTool_Prefetch(thePtr)
+#endif
 
 namespace
 {
@@ -54,19 +65,33 @@ private:
   Poly_MergeNodesTool::Vec3AndNormal myKey;
 };
 
+// =======================================================================
+// function : MergedNodesMap::allocatorBlockSize
+// purpose  :
+// =======================================================================
+size_t Poly_MergeNodesTool::MergedNodesMap::allocatorBlockSize (const int theNbBuckets)
+{
+  // consider ratio 4:1 (NbBuckets:Nodes) basing on bucket number estimation from facets
+  const size_t anExpectedNodes = theNbBuckets > 0 ? size_t(theNbBuckets) / 4 : 0;
+  return std::min<size_t> (64 * 1024 * 1024,
+         std::max<size_t> (NCollection_IncAllocator::DefaultBlockSize,
+                           anExpectedNodes * sizeof(DataMapNode)));
+}
+
 // =======================================================================
 // function : MergedNodesMap
 // purpose  :
 // =======================================================================
 Poly_MergeNodesTool::MergedNodesMap::MergedNodesMap (const int theNbBuckets)
-: NCollection_BaseMap (theNbBuckets, true, new NCollection_IncAllocator()),
+: NCollection_BaseMap (theNbBuckets, true, new NCollection_IncAllocator (allocatorBlockSize (theNbBuckets))),
   myTolerance(0.0f),
   myInvTol   (0.0f),
   myAngle    (1.0f),
   myAngleCos (0.0f),
-  myToMergeOpposite (false)
+  myToMergeOpposite (false),
+  myRecentIter (0)
 {
-  //
+  std::memset (myRecentNodes, 0, sizeof(myRecentNodes));
 }
 
 // =======================================================================
@@ -110,7 +135,14 @@ inline int Poly_MergeNodesTool::MergedNodesMap::hashCode (const NCollection_Vec3
   (void )theNorm;
   if (myInvTol <= 0.0f)
   {
-    return ::HashCode (::HashCodes ((Standard_CString )&thePos, sizeof(NCollection_Vec3<float>)), theUpper);
+    // exact match - hash the 96-bit pattern of float coordinates as integers
+    // instead of calling the bytewise HashCodes() on the hot path
+    uint32_t aKey[3];
+    std::memcpy (aKey, thePos.GetData(), sizeof(aKey));
+    const uint64_t aHash64 = (uint64_t(aKey[0]) * 73856093u)
+                           ^ (uint64_t(aKey[1]) * 19349669u)
+                           ^ (uint64_t(aKey[2]) * 83492791u);
+    return IntegerHashCode (aHash64, 0x7fffffffffffffff, theUpper);
   }
 
   const CellVec3i anIndex = vec3ToCell (thePos);
@@ -175,6 +207,21 @@ inline bool Poly_MergeNodesTool::MergedNodesMap::isEqual (const Vec3AndNormal& t
   return false;
 }
 
+// =======================================================================
+// function : MergedNodesMap::Prefetch
+// purpose  :
+// =======================================================================
+inline void Poly_MergeNodesTool::MergedNodesMap::Prefetch (const NCollection_Vec3<float>& thePos,
+                                                           const NCollection_Vec3<float>& theNorm) const
+{
+  if (myData1 != NULL
+  && !Resizable())
+  {
+    const int aHash = hashCode (thePos, theNorm, NbBuckets());
+    Poly_MergeNodesTool_Prefetch (((DataMapNode** )myData1) + aHash);
+  }
+}
+
 // =======================================================================
 // function : MergedNodesMap::Bind
 // purpose  :
@@ -189,6 +236,26 @@ inline bool Poly_MergeNodesTool::MergedNodesMap::Bind (int& theIndex,
     ReSize (Extent());
   }
 
+  // consecutive elements share edges, so that recently accessed nodes repeat closely;
+  // check a small ring of them before hashing into the map.
+  // This shortcut is restricted to exact position matching without normal filtering,
+  // where a position cannot be bound to two different nodes and thus
+  // the ring cannot disagree with the bucket scan order
+  const bool toUseRecent = myInvTol <= 0.0f && ToMergeAnyAngle();
+  if (toUseRecent)
+  {
+    for (int aRecentIter = 0; aRecentIter < THE_NB_RECENT_NODES; ++aRecentIter)
+    {
+      DataMapNode* aNode = myRecentNodes[aRecentIter];
+      if (aNode != NULL
+       && isEqual (aNode->Key(), thePos, theNorm, theIsOpposite))
+      {
+        theIndex = aNode->ChangeValue();
+        return false;
+      }
+    }
+  }
+
   DataMapNode** aData = (DataMapNode** )myData1;
   const int aHash = hashCode (thePos, theNorm, NbBuckets());
   for (DataMapNode* aNodeIter = aData[aHash]; aNodeIter != NULL;
@@ -196,6 +263,11 @@ inline bool Poly_MergeNodesTool::MergedNodesMap::Bind (int& theIndex,
   {
     if (isEqual (aNodeIter->Key(), thePos, theNorm, theIsOpposite))
     {
+      if (toUseRecent)
+      {
+        myRecentNodes[myRecentIter] = aNodeIter;
+        myRecentIter = (myRecentIter + 1) % THE_NB_RECENT_NODES;
+      }
       theIndex = aNodeIter->ChangeValue();
       return false;
     }
@@ -228,6 +300,11 @@ inline bool Poly_MergeNodesTool::MergedNodesMap::Bind (int& theIndex,
   }
   //theIsOpposite = false;
   aData[aHash] = new (this->myAllocator) DataMapNode (thePos, theNorm, theIndex, aData[aHash]);
+  if (toUseRecent)
+  {
+    myRecentNodes[myRecentIter] = aData[aHash];
+    myRecentIter = (myRecentIter + 1) % THE_NB_RECENT_NODES;
+  }
   Increment();
   return true;
 }
@@ -332,6 +409,17 @@ void Poly_MergeNodesTool::PushLastElement (int theNbNodes)
       myTriNormal = computeTriNormal();
     }
 
+    // convert element coordinates to compact float keys once -
+    // the whole element then fits a single cache line instead of 96 bytes of doubles -
+    // and prefetch map buckets of all nodes upfront,
+    // so that memory latencies of the lookups below overlap
+    for (int aNodeIter = 0; aNodeIter < theNbNodes; ++aNodeIter)
+    {
+      const gp_XYZ& aPlace = myPlaces[aNodeIter];
+      myPlaceVecs[aNodeIter].SetValues ((float )aPlace.X(), (float )aPlace.Y(), (float )aPlace.Z());
+      myNodeIndexMap.Prefetch (myPlaceVecs[aNodeIter], myTriNormal);
+    }
+
     pushNodeCheck (isOpposite, 0);
     pushNodeCheck (isOpposite, 1);
     pushNodeCheck (isOpposite, 2);
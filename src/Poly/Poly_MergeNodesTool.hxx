@@ -162,13 +162,13 @@ public:
 private:
 
   //! Push triangle node with normal angle comparison.
+  //! Uses coordinates pre-converted to floats by PushLastElement().
   void pushNodeCheck (bool& theIsOpposite,
                       const int theTriNode)
   {
     int aNodeIndex = myNbNodes;
     const gp_XYZ& aPlace = myPlaces[theTriNode];
-    const NCollection_Vec3<float> aVec3 ((float )aPlace.X(), (float )aPlace.Y(), (float )aPlace.Z());
-    if (myNodeIndexMap.Bind (aNodeIndex, theIsOpposite, aVec3, myTriNormal))
+    if (myNodeIndexMap.Bind (aNodeIndex, theIsOpposite, myPlaceVecs[theTriNode], myTriNormal))
     {
       ++myNbNodes;
       if (!myPolyData.IsNull())
@@ -268,6 +268,11 @@ private:
                                const NCollection_Vec3<float>& thePos,
                                const NCollection_Vec3<float>& theNorm);
 
+    //! Prefetch the bucket of the given node into CPU cache,
+    //! so that memory latencies of several consecutive Bind() calls overlap.
+    Standard_EXPORT void Prefetch (const NCollection_Vec3<float>& thePos,
+                                   const NCollection_Vec3<float>& theNorm) const;
+
     //! ReSize the map.
     Standard_EXPORT void ReSize (const int theSize);
 
@@ -279,6 +284,10 @@ private:
       return CellVec3i (thePnt * myInvTol);
     }
 
+    //! Choose region size of the incremental allocator from the expected number of map nodes,
+    //! so that small meshes do not over-allocate and large meshes avoid numerous block requests.
+    Standard_EXPORT static size_t allocatorBlockSize (const int theNbBuckets);
+
     //! Hash code for integer vec3.
     Standard_EXPORT static int vec3iHashCode (const Poly_MergeNodesTool::MergedNodesMap::CellVec3i& theVec,
                                               const int theUpper);
@@ -306,12 +315,18 @@ private:
   private:
     //! Map node.
     class DataMapNode;
+
+    //! Number of recently accessed nodes kept for lookup without hashing;
+    //! consecutive elements share edges, so that the same nodes repeat closely.
+    static const int THE_NB_RECENT_NODES = 8;
   private:
     float myTolerance;       //!< linear tolerance for comparison
     float myInvTol;          //!< inversed linear tolerance for comparison
     float myAngle;           //!< angle for comparison
     float myAngleCos;        //!< angle cosine for comparison
     bool  myToMergeOpposite; //!< merge nodes with opposite normals
+    DataMapNode* myRecentNodes[THE_NB_RECENT_NODES]; //!< ring of recently accessed nodes
+    int          myRecentIter;                       //!< next slot to evict in the ring
   };
 
   //! Hasher for merging equal elements (with pre-sorted indexes).
@@ -342,6 +357,7 @@ private:
   NCollection_Vec4<int>      myNodeInds;           //!< current element indexes
   NCollection_Vec3<float>    myTriNormal;          //!< current triangle normal
   gp_XYZ                     myPlaces[4];          //!< current triangle/quad coordinates to push
+  NCollection_Vec3<float>    myPlaceVecs[4];       //!< current element coordinates as compact float keys
 
   Standard_Real              myUnitFactor;         //!< scale factor to apply
   Standard_Integer           myNbNodes;            //!< number of output nodes
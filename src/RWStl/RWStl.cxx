@@ -66,6 +66,22 @@ namespace
   class Reader : public RWStl_Reader
   {
   public:
+    //! Reserve collections for the expected mesh size;
+    //! NCollection_Vector allocates memory by increment blocks,
+    //! so that the increment is set to fit the whole mesh into the first block
+    virtual void Reserve (const Standard_Integer theNbNodesHint,
+                          const Standard_Integer theNbTrianglesHint) Standard_OVERRIDE
+    {
+      if (myNodes.IsEmpty() && theNbNodesHint > 0)
+      {
+        myNodes = NCollection_Vector<gp_XYZ> (theNbNodesHint);
+      }
+      if (myTriangles.IsEmpty() && theNbTrianglesHint > 0)
+      {
+        myTriangles = NCollection_Vector<Poly_Triangle> (theNbTrianglesHint);
+      }
+    }
+
     //! Add new node
     virtual Standard_Integer AddNode (const gp_XYZ& thePnt) Standard_OVERRIDE
     {
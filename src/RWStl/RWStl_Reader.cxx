@@ -18,16 +18,35 @@
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
-#include <NCollection_DataMap.hxx>
-#include <NCollection_IncAllocator.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_Thread.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
+#include <vector>
+
+// use SSE2 intrinsics to decode facet coordinates on x86 targets
+// (which are little-endian, so that no byte swapping is involved)
+#if !(OCCT_BINARY_FILE_DO_INVERSE) \
+ && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+  #define RWStl_HAS_SSE2
+  #include <emmintrin.h>
+#endif
+
+// branch prediction hints for the parsing hot loops
+#if defined(__GNUC__) || defined(__clang__)
+  #define RWStl_LIKELY(theExpr)   __builtin_expect(!!(theExpr), 1)
+  #define RWStl_UNLIKELY(theExpr) __builtin_expect(!!(theExpr), 0)
+#else
+  #define RWStl_LIKELY(theExpr)   (theExpr)
+  #define RWStl_UNLIKELY(theExpr) (theExpr)
+#endif
 
 IMPLEMENT_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
 
@@ -41,6 +60,19 @@ namespace
   // The length of buffer to read (in bytes)
   static const size_t THE_BUFFER_SIZE = 1024;
 
+  // The length of buffer to read binary facet data (in bytes);
+  // the entire payload is read at once when it fits into this buffer
+  static const size_t THE_STL_BULK_BUFFER_SIZE = 32 * 1024 * 1024;
+
+  // Minimal number of facets in a binary file to engage multi-threaded node merging
+  static const Standard_Integer THE_STL_PARALLEL_MIN_NBFACETS = 100000;
+
+  // Maximal payload length (in bytes) to be fully buffered for multi-threaded node merging
+  static const size_t THE_STL_PARALLEL_BUFFER_SIZE = 256 * 1024 * 1024;
+
+  // Maximal length of Ascii STL text (in bytes) to be fully buffered and parsed in place
+  static const size_t THE_STL_ASCII_BULK_BUFFER_SIZE = 256 * 1024 * 1024;
+
   //! Auxiliary tool for merging nodes during STL reading.
   class MergeNodeTool : public Poly_MergeNodesTool
   {
@@ -50,11 +82,15 @@ namespace
     MergeNodeTool (RWStl_Reader* theReader,
                    const Standard_Integer theNbFacets = -1)
     : Poly_MergeNodesTool (theReader->MergeAngle(), 0.0, theNbFacets),
-      myReader (theReader),
-      myNodeIndexMap (1024, new NCollection_IncAllocator (1024 * 1024))
+      myReader (theReader)
     {
       // avoid redundant allocations as final triangulation is managed by RWStl_Reader subclass
       ChangeOutput().Nullify();
+
+      // node indices assigned by Poly_MergeNodesTool are dense and sequential,
+      // so that remapping is done through a flat table instead of a hash map;
+      // rough estimation of 1 node per 2 facets is used for watertight meshes
+      myNodeIndexMap.reserve (theNbFacets > 0 ? size_t(theNbFacets) / 2 : 1024);
     }
 
     //! Add new triangle
@@ -64,20 +100,26 @@ namespace
 
       // remap node indices returned by RWStl_Reader::AddNode();
       // this is a waste of time for most cases of sequential index adding, but preserved for keeping RWStl_Reader interface
-      int aNodesSrc[3] = { ElementNodeIndex (0), ElementNodeIndex (1), ElementNodeIndex (2) };
       int aNodesRes[3] = { -1, -1, -1 };
       for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
       {
+        const Standard_Integer aNodeSrc = ElementNodeIndex (aNodeIter);
+        if (size_t(aNodeSrc) >= myNodeIndexMap.size())
+        {
+          myNodeIndexMap.resize (size_t(aNodeSrc) + 1, -1);
+        }
+
         // use existing node if found at the same point
-        if (!myNodeIndexMap.Find (aNodesSrc[aNodeIter], aNodesRes[aNodeIter]))
+        Standard_Integer& aNodeRes = myNodeIndexMap[size_t(aNodeSrc)];
+        if (aNodeRes < 0)
         {
-          aNodesRes[aNodeIter] = myReader->AddNode (theElemNodes[aNodeIter]);
-          myNodeIndexMap.Bind (aNodesSrc[aNodeIter], aNodesRes[aNodeIter]);
+          aNodeRes = myReader->AddNode (theElemNodes[aNodeIter]);
         }
+        aNodesRes[aNodeIter] = aNodeRes;
       }
-      if (aNodesRes[0] != aNodesRes[1]
-       && aNodesRes[1] != aNodesRes[2]
-       && aNodesRes[2] != aNodesRes[0])
+      if (RWStl_LIKELY(aNodesRes[0] != aNodesRes[1]
+                    && aNodesRes[1] != aNodesRes[2]
+                    && aNodesRes[2] != aNodesRes[0]))
       {
         myReader->AddTriangle (aNodesRes[0], aNodesRes[1], aNodesRes[2]);
       }
@@ -85,36 +127,379 @@ namespace
 
   private:
     RWStl_Reader* myReader;
-    NCollection_DataMap<Standard_Integer, Standard_Integer> myNodeIndexMap;
+    std::vector<Standard_Integer> myNodeIndexMap; //!< remapping of Poly_MergeNodesTool node index into RWStl_Reader::AddNode() index
+  };
+
+  //! Task reading the next chunk of binary facet data within a background thread.
+  struct ReadChunkTask
+  {
+    Standard_IStream* Stream;  //!< stream to read from
+    char*             Buffer;  //!< destination buffer
+    std::streamsize   NbBytes; //!< number of bytes to read
+    bool              IsDone;  //!< reading result
+
+    ReadChunkTask() : Stream (NULL), Buffer (NULL), NbBytes (0), IsDone (false) {}
   };
 
+  //! Thread function performing ReadChunkTask.
+  static Standard_Address readChunkThreadFunc (Standard_Address theTask)
+  {
+    ReadChunkTask* aTask = (ReadChunkTask* )theTask;
+    aTask->IsDone = aTask->Stream->read (aTask->Buffer, aTask->NbBytes).gcount() == aTask->NbBytes;
+    return NULL;
+  }
+
   //! Read a Little Endian 32 bits float
   inline static float readStlFloat (const char* theData)
   {
   #if OCCT_BINARY_FILE_DO_INVERSE
-    // on big-endian platform, map values byte-per-byte
-    union
-    {
-      uint32_t i;
-      float    f;
-    } bidargum;
-    bidargum.i  =  theData[0] & 0xFF;
-    bidargum.i |= (theData[1] & 0xFF) << 0x08;
-    bidargum.i |= (theData[2] & 0xFF) << 0x10;
-    bidargum.i |= (theData[3] & 0xFF) << 0x18;
-    return bidargum.f;
+    // on big-endian platform, revert the byte order by a single swap instruction
+    uint32_t anInt;
+    std::memcpy (&anInt, theData, sizeof(anInt));
+  #ifdef _MSC_VER
+    anInt = _byteswap_ulong (anInt);
   #else
-    // on little-endian platform, use plain cast
-    return *reinterpret_cast<const float*>(theData);
+    anInt = __builtin_bswap32 (anInt);
+  #endif
+    float aFloat;
+    std::memcpy (&aFloat, &anInt, sizeof(aFloat));
+    return aFloat;
+  #else
+    // on little-endian platform, use memcpy which compilers fold into a single load
+    // (plain cast of unaligned char* would be undefined behavior)
+    float aFloat;
+    std::memcpy (&aFloat, theData, sizeof(aFloat));
+    return aFloat;
   #endif
   }
 
   //! Read a Little Endian 32 bits float
   inline static gp_XYZ readStlFloatVec3 (const char* theData)
   {
+  #if OCCT_BINARY_FILE_DO_INVERSE
     return gp_XYZ (readStlFloat (theData),
                    readStlFloat (theData + sizeof(float)),
                    readStlFloat (theData + sizeof(float) * 2));
+  #else
+    // single 12-byte copy lets the SLP vectorizer combine the three loads
+    float aVec[3];
+    std::memcpy (aVec, theData, sizeof(aVec));
+    return gp_XYZ (aVec[0], aVec[1], aVec[2]);
+  #endif
+  }
+
+  //! Decode 9 packed Little Endian 32 bits floats (3 facet nodes) at once.
+  inline static void readStlFloatVec3x3 (const char* theData, gp_XYZ theNodes[3])
+  {
+  #ifdef RWStl_HAS_SSE2
+    // convert 4 floats per instruction instead of one-by-one;
+    // the gp_XYZ triple is filled as a contiguous array of 9 doubles
+    double* aData = theNodes[0].ChangeData();
+    const __m128 aVec0 = _mm_loadu_ps (reinterpret_cast<const float*>(theData));
+    const __m128 aVec1 = _mm_loadu_ps (reinterpret_cast<const float*>(theData) + 4);
+    _mm_storeu_pd (aData + 0, _mm_cvtps_pd (aVec0));
+    _mm_storeu_pd (aData + 2, _mm_cvtps_pd (_mm_movehl_ps (aVec0, aVec0)));
+    _mm_storeu_pd (aData + 4, _mm_cvtps_pd (aVec1));
+    _mm_storeu_pd (aData + 6, _mm_cvtps_pd (_mm_movehl_ps (aVec1, aVec1)));
+    aData[8] = double(readStlFloat (theData + sizeof(float) * 8));
+  #else
+    theNodes[0] = readStlFloatVec3 (theData);
+    theNodes[1] = readStlFloatVec3 (theData + sizeof(float) * 3);
+    theNodes[2] = readStlFloatVec3 (theData + sizeof(float) * 3 * 2);
+  #endif
+  }
+
+  //! Multi-threaded deduplication of binary STL facet nodes merged by exact position.
+  //! Vertices are partitioned between a fixed number of shards by a position hash,
+  //! and each shard collects unique positions of its own subset within a private
+  //! open-addressed table, so that no synchronization is involved.
+  //! Final node indices follow the first-encounter order of unique positions,
+  //! which makes the result identical to the sequential reading path
+  //! (and independent from the number of threads).
+  class ParallelFacetMerger
+  {
+  public:
+    //! Number of vertex shards; fixed to keep the node order deterministic.
+    static const Standard_Integer THE_NB_SHARDS = 16;
+
+    //! Number of facets processed by a single hashing/remapping task.
+    static const Standard_Integer THE_BLOCK_NBFACETS = 16384;
+
+  public:
+    //! Main constructor.
+    //! @param theFacetData payload of binary facet records (50 bytes per facet)
+    //! @param theNbFacets  number of facets within the payload
+    ParallelFacetMerger (const char* theFacetData,
+                         const Standard_Integer theNbFacets)
+    : myFacetData   (theFacetData),
+      myNbFacets    (theNbFacets),
+      myHashes      (size_t(theNbFacets) * 3),
+      myNodeIndexes (size_t(theNbFacets) * 3),
+      myNodeRanks   (size_t(theNbFacets) * 3 + 1),
+      myIsFirst     (size_t(theNbFacets) * 3, 0),
+      myNbNodes     (0)
+    {
+      // expect ratio 1:2 (NbTriangles:MergedNodes) and 75% maximal load factor
+      const size_t anExpectedNodes = size_t(theNbFacets) / 2 / THE_NB_SHARDS + 1;
+      size_t aCapacity = 1024;
+      while (aCapacity < anExpectedNodes * 2) { aCapacity *= 2; }
+      Entry anEmptyEntry;
+      anEmptyEntry.Key[0] = anEmptyEntry.Key[1] = anEmptyEntry.Key[2] = 0;
+      anEmptyEntry.FirstV = -1;
+      for (Standard_Integer aShardIter = 0; aShardIter < THE_NB_SHARDS; ++aShardIter)
+      {
+        myShards[aShardIter].Table.resize (aCapacity, anEmptyEntry);
+        myShards[aShardIter].NbEntries = 0;
+      }
+    }
+
+    //! Perform the deduplication passes.
+    void Perform()
+    {
+      const Standard_Integer aNbBlocks = (myNbFacets + THE_BLOCK_NBFACETS - 1) / THE_BLOCK_NBFACETS;
+      OSD_Parallel::For (0, aNbBlocks, HashTask (this));
+      OSD_Parallel::For (0, THE_NB_SHARDS, DedupTask (this));
+
+      // exclusive prefix sum over first-encounter flags assigns final node indices
+      int32_t aRank = 0;
+      const size_t aNbVerts = size_t(myNbFacets) * 3;
+      for (size_t aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+      {
+        myNodeRanks[aVertIter] = aRank;
+        aRank += myIsFirst[aVertIter];
+      }
+      myNodeRanks[aNbVerts] = aRank;
+      myNbNodes = aRank;
+
+      OSD_Parallel::For (0, aNbBlocks, RemapTask (this));
+    }
+
+    //! Return number of unique nodes.
+    Standard_Integer NbNodes() const { return myNbNodes; }
+
+    //! Return TRUE if the vertex is the first occurrence of its position.
+    bool IsFirstOccurrence (size_t theVertex) const { return myIsFirst[theVertex] != 0; }
+
+    //! Return final node index for each of 3 * NbFacets vertices.
+    const int32_t* NodeIndexes() const { return myNodeIndexes.data(); }
+
+    //! Return pointer to packed float coordinates of the vertex.
+    const char* VertexData (size_t theVertex) const
+    {
+      return myFacetData + (theVertex / 3) * THE_STL_SIZEOF_FACET
+           + sizeof(float) * 3 * (1 + theVertex % 3);
+    }
+
+  private:
+
+    //! Open-addressed table entry holding a packed vertex position.
+    struct Entry
+    {
+      uint32_t Key[3]; //!< bit pattern of float32 vertex position
+      int32_t  FirstV; //!< index of the first vertex at this position; -1 for a free slot
+    };
+
+    //! Vertex shard with a private hash table.
+    struct Shard
+    {
+      std::vector<Entry> Table;     //!< open-addressed table of power-of-2 size
+      size_t             NbEntries; //!< number of occupied slots
+    };
+
+    //! Compute 32-bit hash of a packed vertex position.
+    static uint32_t hashVertex (const char* theVec3Data)
+    {
+      uint32_t aKey[3];
+      std::memcpy (aKey, theVec3Data, sizeof(aKey));
+      const uint64_t aHash64 = (uint64_t(aKey[0]) * 73856093u)
+                             ^ (uint64_t(aKey[1]) * 19349669u)
+                             ^ (uint64_t(aKey[2]) * 83492791u);
+      return uint32_t(aHash64) ^ uint32_t(aHash64 >> 32);
+    }
+
+    //! Compute position hashes of all vertices within the block of facets.
+    void hashBlock (Standard_Integer theBlock)
+    {
+      const size_t aLower = size_t(theBlock) * THE_BLOCK_NBFACETS * 3;
+      const size_t anUpper = std::min (aLower + THE_BLOCK_NBFACETS * 3, size_t(myNbFacets) * 3);
+      for (size_t aVertIter = aLower; aVertIter < anUpper; ++aVertIter)
+      {
+        myHashes[aVertIter] = hashVertex (VertexData (aVertIter));
+      }
+    }
+
+    //! Collect unique positions of the shard within its private table.
+    void dedupShard (Standard_Integer theShard)
+    {
+      Shard& aShard = myShards[theShard];
+      const size_t aNbVerts = size_t(myNbFacets) * 3;
+      for (size_t aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+      {
+        const uint32_t aHash = myHashes[aVertIter];
+        if (Standard_Integer(aHash & (THE_NB_SHARDS - 1)) != theShard)
+        {
+          continue;
+        }
+
+        uint32_t aKey[3];
+        std::memcpy (aKey, VertexData (aVertIter), sizeof(aKey));
+        size_t aMask = aShard.Table.size() - 1;
+        size_t aSlot = (aHash >> 4) & aMask; // shard selection bits are excluded
+        for (;;)
+        {
+          Entry& anEntry = aShard.Table[aSlot];
+          if (anEntry.FirstV < 0)
+          {
+            std::memcpy (anEntry.Key, aKey, sizeof(aKey));
+            anEntry.FirstV = int32_t(aVertIter);
+            myIsFirst[aVertIter] = 1;
+            if (++aShard.NbEntries * 4 >= aShard.Table.size() * 3)
+            {
+              resizeShard (aShard);
+            }
+            break;
+          }
+          if (std::memcmp (anEntry.Key, aKey, sizeof(aKey)) == 0)
+          {
+            break;
+          }
+          aSlot = (aSlot + 1) & aMask;
+        }
+      }
+    }
+
+    //! Double the shard table and reinsert its entries.
+    static void resizeShard (Shard& theShard)
+    {
+      std::vector<Entry> anOldTable;
+      anOldTable.swap (theShard.Table);
+      Entry anEmptyEntry;
+      anEmptyEntry.Key[0] = anEmptyEntry.Key[1] = anEmptyEntry.Key[2] = 0;
+      anEmptyEntry.FirstV = -1;
+      theShard.Table.resize (anOldTable.size() * 2, anEmptyEntry);
+      const size_t aMask = theShard.Table.size() - 1;
+      for (size_t anOldIter = 0; anOldIter < anOldTable.size(); ++anOldIter)
+      {
+        const Entry& anOldEntry = anOldTable[anOldIter];
+        if (anOldEntry.FirstV < 0)
+        {
+          continue;
+        }
+        size_t aSlot = (hashVertex ((const char* )anOldEntry.Key) >> 4) & aMask;
+        while (theShard.Table[aSlot].FirstV >= 0)
+        {
+          aSlot = (aSlot + 1) & aMask;
+        }
+        theShard.Table[aSlot] = anOldEntry;
+      }
+    }
+
+    //! Resolve final node indices for all vertices within the block of facets.
+    void remapBlock (Standard_Integer theBlock)
+    {
+      const size_t aLower = size_t(theBlock) * THE_BLOCK_NBFACETS * 3;
+      const size_t anUpper = std::min (aLower + THE_BLOCK_NBFACETS * 3, size_t(myNbFacets) * 3);
+      for (size_t aVertIter = aLower; aVertIter < anUpper; ++aVertIter)
+      {
+        const uint32_t aHash = aHashOf (aVertIter);
+        const Shard& aShard = myShards[aHash & (THE_NB_SHARDS - 1)];
+        uint32_t aKey[3];
+        std::memcpy (aKey, VertexData (aVertIter), sizeof(aKey));
+        const size_t aMask = aShard.Table.size() - 1;
+        size_t aSlot = (aHash >> 4) & aMask;
+        while (std::memcmp (aShard.Table[aSlot].Key, aKey, sizeof(aKey)) != 0
+            || aShard.Table[aSlot].FirstV < 0)
+        {
+          aSlot = (aSlot + 1) & aMask;
+        }
+        myNodeIndexes[aVertIter] = myNodeRanks[aShard.Table[aSlot].FirstV];
+      }
+    }
+
+    uint32_t aHashOf (size_t theVertex) const { return myHashes[theVertex]; }
+
+  private:
+
+    //! Functor computing vertex hashes.
+    struct HashTask
+    {
+      explicit HashTask (ParallelFacetMerger* theMerger) : Merger (theMerger) {}
+      void operator() (const Standard_Integer theBlock) const { Merger->hashBlock (theBlock); }
+      ParallelFacetMerger* Merger;
+    };
+
+    //! Functor deduplicating one shard.
+    struct DedupTask
+    {
+      explicit DedupTask (ParallelFacetMerger* theMerger) : Merger (theMerger) {}
+      void operator() (const Standard_Integer theShard) const { Merger->dedupShard (theShard); }
+      ParallelFacetMerger* Merger;
+    };
+
+    //! Functor resolving final node indices.
+    struct RemapTask
+    {
+      explicit RemapTask (ParallelFacetMerger* theMerger) : Merger (theMerger) {}
+      void operator() (const Standard_Integer theBlock) const { Merger->remapBlock (theBlock); }
+      ParallelFacetMerger* Merger;
+    };
+
+  private:
+    const char*           myFacetData;            //!< payload of binary facet records
+    Standard_Integer      myNbFacets;             //!< number of facets
+    std::vector<uint32_t> myHashes;               //!< position hash per vertex
+    std::vector<int32_t>  myNodeIndexes;          //!< final node index per vertex
+    std::vector<int32_t>  myNodeRanks;            //!< first-encounter rank per vertex
+    std::vector<char>     myIsFirst;              //!< per-vertex first-encounter flags
+    Shard                 myShards[THE_NB_SHARDS];//!< vertex shards
+    Standard_Integer      myNbNodes;              //!< number of unique nodes
+  };
+
+  //! Read fully buffered binary STL payload with multi-threaded node merging.
+  static Standard_Boolean readBinaryParallel (RWStl_Reader& theReader,
+                                              Standard_IStream& theStream,
+                                              const Standard_Integer theNbFacets,
+                                              const Message_ProgressRange& theProgress)
+  {
+    Message_ProgressScope aPS (theProgress, "Reading binary STL file", theNbFacets);
+    std::vector<char> aPayload (size_t(theNbFacets) * THE_STL_SIZEOF_FACET);
+    const std::streamsize aDataToRead = std::streamsize(aPayload.size());
+    if (theStream.read (aPayload.data(), aDataToRead).gcount() != aDataToRead)
+    {
+      Message::SendFail ("Error: binary STL read failed");
+      return false;
+    }
+
+    ParallelFacetMerger aMerger (aPayload.data(), theNbFacets);
+    aMerger.Perform();
+    theReader.Reserve (aMerger.NbNodes(), theNbFacets);
+
+    // emit unique nodes in the first-encounter order
+    std::vector<Standard_Integer> aNodeIds (aMerger.NbNodes());
+    const size_t aNbVerts = size_t(theNbFacets) * 3;
+    for (size_t aVertIter = 0, aNodeIter = 0; aVertIter < aNbVerts; ++aVertIter)
+    {
+      if (aMerger.IsFirstOccurrence (aVertIter))
+      {
+        aNodeIds[aNodeIter++] = theReader.AddNode (readStlFloatVec3 (aMerger.VertexData (aVertIter)));
+      }
+    }
+
+    // emit triangles, skipping degenerate ones as the merge tool does
+    const int32_t* aNodeIndexes = aMerger.NodeIndexes();
+    for (Standard_Integer aFacetIter = 0; aFacetIter < theNbFacets && aPS.More(); ++aFacetIter, aPS.Next())
+    {
+      const Standard_Integer aNode1 = aNodeIds[aNodeIndexes[aFacetIter * 3 + 0]];
+      const Standard_Integer aNode2 = aNodeIds[aNodeIndexes[aFacetIter * 3 + 1]];
+      const Standard_Integer aNode3 = aNodeIds[aNodeIndexes[aFacetIter * 3 + 2]];
+      if (RWStl_LIKELY(aNode1 != aNode2
+                    && aNode2 != aNode3
+                    && aNode3 != aNode1))
+      {
+        theReader.AddTriangle (aNode1, aNode2, aNode3);
+      }
+    }
+    return aPS.More();
   }
 
 }
@@ -209,10 +594,18 @@ Standard_Boolean RWStl_Reader::IsAscii (Standard_IStream& theStream,
   }
   else
   {
-    // put back the read symbols
-    for (std::streamsize aByteIter = aNbRead; aByteIter > 0; --aByteIter)
+    // try repositioning by a single relative seek first -
+    // it commonly succeeds even for streams not reporting seekg support,
+    // while per-byte unget involves a virtual call per read symbol
+    theStream.seekg (-aNbRead, std::ios::cur);
+    if (theStream.fail())
     {
-      theStream.unget();
+      theStream.clear();
+      // put back the read symbols
+      for (std::streamsize aByteIter = aNbRead; aByteIter > 0; --aByteIter)
+      {
+        theStream.unget();
+      }
     }
   }
 
@@ -224,7 +617,23 @@ Standard_Boolean RWStl_Reader::IsAscii (Standard_IStream& theStream,
 
   // otherwise, detect binary format by presence of non-ascii symbols in first 128 bytes
   // (note that binary STL file may start with the same bytes "solid " as Ascii one)
-  for (Standard_Integer aByteIter = 0; aByteIter < aNbRead; ++aByteIter)
+  Standard_Integer aByteIter = 0;
+#ifdef RWStl_HAS_SSE2
+  // check 16 bytes per iteration - a byte is non-ascii when its signed value
+  // is negative (>= 0x80) or greater than '~' (0x7E)
+  const __m128i aTildeVec = _mm_set1_epi8 ('~');
+  for (; aByteIter + 16 <= aNbRead; aByteIter += 16)
+  {
+    const __m128i aBytes = _mm_loadu_si128 (reinterpret_cast<const __m128i*>(aBuffer + aByteIter));
+    const __m128i aNonAscii = _mm_or_si128 (_mm_cmpgt_epi8 (aBytes, aTildeVec),
+                                            _mm_cmplt_epi8 (aBytes, _mm_setzero_si128()));
+    if (_mm_movemask_epi8 (aNonAscii) != 0)
+    {
+      return false;
+    }
+  }
+#endif
+  for (; aByteIter < aNbRead; ++aByteIter)
   {
     if ((unsigned char )aBuffer[aByteIter] > (unsigned char )'~')
     {
@@ -267,23 +676,304 @@ static inline bool str_starts_with (const char* theStr, const char* theWord, int
   return !strncasecmp (theStr, theWord, theN);
 }
 
+//! Pack a keyword of up to 8 characters into a little-endian 64-bit word at compile time.
+static constexpr uint64_t keywordWord (const char* theWord, int theIdx = 0)
+{
+  return theIdx >= 8 || theWord[theIdx] == '\0'
+       ? 0
+       : (uint64_t(uint8_t(theWord[theIdx])) << (8 * theIdx)) | keywordWord (theWord, theIdx + 1);
+}
+
+//! Compute the byte mask covering the characters of the keyword.
+static constexpr uint64_t keywordMask (const char* theWord, int theIdx = 0)
+{
+  return theIdx >= 8 || theWord[theIdx] == '\0'
+       ? 0
+       : (uint64_t(0xFF) << (8 * theIdx)) | keywordMask (theWord, theIdx + 1);
+}
+
+//! Skip leading spaces and tabulations of the line.
+static inline const char* skipSpaces (const char* thePos)
+{
+  while (*thePos == ' ' || *thePos == '\t') { ++thePos; }
+  return thePos;
+}
+
+//! Match a lowercase keyword of up to 8 characters at the given position by a single
+//! masked case-insensitive 64-bit comparison instead of a per-character scan.
+//! At least 8 bytes should be readable at thePos (guaranteed by the bulk buffer padding).
+static inline bool matchKeyword8 (const char* thePos, uint64_t theWord, uint64_t theMask)
+{
+  uint64_t aVal;
+  std::memcpy (&aVal, thePos, sizeof(aVal));
+  return ((aVal | 0x2020202020202020ULL) & theMask) == theWord;
+}
+
+//! Report a parsing error with the line number;
+//! kept non-inlined so that message formatting does not bloat the parsing hot loop.
+Standard_NOINLINE static void reportLineError (const char* theMessage, Standard_Integer theNbLine)
+{
+  Message::SendFail (TCollection_AsciiString (theMessage) + theNbLine);
+}
+
+// Exactly representable powers of ten for the fast decimal conversion path.
+static const double THE_POWERS_OF_TEN[23] =
+{
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+  1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+//! Parse a real number in the plain decimal/exponent notation used by STL files.
+//! When both the mantissa and the power of ten are exactly representable,
+//! a single multiplication yields the correctly rounded result (Clinger's fast path),
+//! avoiding the digit-at-a-time state machine of strtod();
+//! other inputs (inf/nan, very long mantissas, huge exponents) fall back to Strtod().
+static double strtodFast (const char* theStr, char** theEnd)
+{
+  const char* aPtr = theStr;
+  while (*aPtr == ' ' || *aPtr == '\t')
+  {
+    ++aPtr;
+  }
+
+  bool isNegative = false;
+  if (*aPtr == '+' || *aPtr == '-')
+  {
+    isNegative = (*aPtr == '-');
+    ++aPtr;
+  }
+
+  uint64_t aMantissa = 0;
+  int aNbDigits = 0, aFracShift = 0;
+  bool hasDigits = false;
+  for (; *aPtr >= '0' && *aPtr <= '9'; ++aPtr)
+  {
+    aMantissa = aMantissa * 10 + uint64_t(*aPtr - '0');
+    ++aNbDigits;
+    hasDigits = true;
+  }
+  if (*aPtr == '.')
+  {
+    for (++aPtr; *aPtr >= '0' && *aPtr <= '9'; ++aPtr)
+    {
+      aMantissa = aMantissa * 10 + uint64_t(*aPtr - '0');
+      ++aNbDigits;
+      --aFracShift;
+      hasDigits = true;
+    }
+  }
+  if (!hasDigits || aNbDigits > 15)
+  {
+    // no digits (inf/nan/garbage) or mantissa beyond exact double range
+    return Strtod (theStr, theEnd);
+  }
+
+  int anExponent = 0;
+  if (*aPtr == 'e' || *aPtr == 'E')
+  {
+    const char* anExpPtr = aPtr + 1;
+    bool isExpNegative = false;
+    if (*anExpPtr == '+' || *anExpPtr == '-')
+    {
+      isExpNegative = (*anExpPtr == '-');
+      ++anExpPtr;
+    }
+    if (*anExpPtr >= '0' && *anExpPtr <= '9')
+    {
+      for (; *anExpPtr >= '0' && *anExpPtr <= '9'; ++anExpPtr)
+      {
+        if (anExponent < 10000)
+        {
+          anExponent = anExponent * 10 + (*anExpPtr - '0');
+        }
+      }
+      if (isExpNegative)
+      {
+        anExponent = -anExponent;
+      }
+      aPtr = anExpPtr;
+    }
+  }
+
+  anExponent += aFracShift;
+  if (anExponent < -22 || anExponent > 22)
+  {
+    return Strtod (theStr, theEnd);
+  }
+
+  double aValue = double(aMantissa);
+  aValue = anExponent >= 0
+         ? aValue * THE_POWERS_OF_TEN[ anExponent]
+         : aValue / THE_POWERS_OF_TEN[-anExponent];
+  *theEnd = const_cast<char*>(aPtr);
+  return isNegative ? -aValue : aValue;
+}
+
+//! Extract the next null-terminated line from the buffer, advancing the position.
+//! The '\n' (and preceding '\r') separator is overwritten by the null character;
+//! the buffer is expected to end with a null sentinel for the last line.
+static char* readBufferLine (char*& thePos, char* theEnd)
+{
+  if (thePos >= theEnd)
+  {
+    return NULL;
+  }
+
+  char* aLine = thePos;
+  char* aNewline = (char* )memchr (thePos, '\n', theEnd - thePos);
+  if (aNewline != NULL)
+  {
+    *aNewline = '\0';
+    if (aNewline > aLine && aNewline[-1] == '\r')
+    {
+      aNewline[-1] = '\0';
+    }
+    thePos = aNewline + 1;
+  }
+  else
+  {
+    thePos = theEnd;
+  }
+  return aLine;
+}
+
 static bool ReadVertex (const char* theStr, double& theX, double& theY, double& theZ)
 {
   const char *aStr = theStr;
 
   // skip 'vertex'
-  while (isspace ((unsigned char)*aStr) || isalpha ((unsigned char)*aStr)) 
+  while (isspace ((unsigned char)*aStr) || isalpha ((unsigned char)*aStr))
     ++aStr;
 
   // read values
   char *aEnd;
-  theX = Strtod (aStr, &aEnd);
-  theY = Strtod (aStr = aEnd, &aEnd);
-  theZ = Strtod (aStr = aEnd, &aEnd);
+  theX = strtodFast (aStr, &aEnd);
+  theY = strtodFast (aStr = aEnd, &aEnd);
+  theZ = strtodFast (aStr = aEnd, &aEnd);
 
   return aEnd != aStr;
 }
 
+//==============================================================================
+//function : readAsciiBuffered
+//purpose  : Parse Ascii STL data from the fully buffered text
+//==============================================================================
+static Standard_Boolean readAsciiBuffered (RWStl_Reader& theReader,
+                                           char* theBuffer,
+                                           const size_t theNbBytes,
+                                           size_t& theConsumed,
+                                           const Message_ProgressRange& theProgress)
+{
+  char* aPos = theBuffer;
+  char* anEnd = theBuffer + theNbBytes;
+  theConsumed = theNbBytes;
+
+  // skip header "solid ..."
+  char* aLine = readBufferLine (aPos, anEnd);
+  // skip empty lines
+  while (aLine && !*aLine)
+  {
+    aLine = readBufferLine (aPos, anEnd);
+  }
+  if (aLine == NULL)
+  {
+    Message::SendFail ("Error: premature end of file");
+    return false;
+  }
+
+  // conservative estimation of the number of facets
+  // (a facet block occupies ~300 bytes of well-formatted text)
+  const Standard_Integer aNbFacetsEstimate = Standard_Integer(theNbBytes / 300);
+
+  MergeNodeTool aMergeTool (&theReader, aNbFacetsEstimate > 0 ? aNbFacetsEstimate : -1);
+  aMergeTool.SetMergeAngle (theReader.MergeAngle());
+  aMergeTool.SetMergeTolerance (theReader.MergeTolerance());
+  if (aNbFacetsEstimate > 0)
+  {
+    theReader.Reserve (aNbFacetsEstimate / 2, aNbFacetsEstimate);
+  }
+
+  // report progress every 1 MiB of parsed data
+  const size_t aStepB = 1024 * 1024;
+  const Standard_Integer aNbSteps = 1 + Standard_Integer(theNbBytes / aStepB);
+  Message_ProgressScope aPS (theProgress, "Reading text STL file", aNbSteps);
+  const char* aProgressPos = theBuffer + aStepB;
+  int aNbLine = 1;
+
+  while (aPS.More())
+  {
+    if (aPos > aProgressPos)
+    {
+      aPS.Next();
+      aProgressPos += aStepB;
+    }
+
+    aLine = readBufferLine (aPos, anEnd); // "facet normal nx ny nz"
+    if (RWStl_UNLIKELY(aLine == NULL))
+    {
+      Message::SendFail ("Error: premature end of file");
+      return false;
+    }
+    const char* aWord = skipSpaces (aLine);
+    if (RWStl_UNLIKELY(matchKeyword8 (aWord, keywordWord ("endsolid"), keywordMask ("endsolid"))))
+    {
+      // end of STL code
+      theConsumed = aPos - theBuffer;
+      break;
+    }
+    if (RWStl_UNLIKELY(!matchKeyword8 (aWord, keywordWord ("facet"), keywordMask ("facet"))))
+    {
+      reportLineError ("Error: unexpected format of facet at line ", aNbLine + 1);
+      return false;
+    }
+
+    aLine = readBufferLine (aPos, anEnd); // "outer loop"
+    if (RWStl_UNLIKELY(aLine == NULL
+                   || !matchKeyword8 (skipSpaces (aLine), keywordWord ("outer"), keywordMask ("outer"))))
+    {
+      reportLineError ("Error: unexpected format of facet at line ", aNbLine + 1);
+      return false;
+    }
+
+    gp_XYZ aVertex[3];
+    Standard_Boolean isEOF = false;
+    for (Standard_Integer i = 0; i < 3; i++)
+    {
+      aLine = readBufferLine (aPos, anEnd);
+      if (aLine == NULL)
+      {
+        isEOF = true;
+        break;
+      }
+      // parse straight into the output array - gp_XYZ triple is contiguous double[9]
+      if (RWStl_UNLIKELY(!ReadVertex (aLine, aVertex[i].ChangeCoord (1), aVertex[i].ChangeCoord (2), aVertex[i].ChangeCoord (3))))
+      {
+        reportLineError ("Error: cannot read vertex coordinates at line ", aNbLine);
+        return false;
+      }
+    }
+
+    // stop reading if end of file is reached;
+    // note that well-formatted file never ends by the vertex line
+    if (RWStl_UNLIKELY(isEOF))
+    {
+      break;
+    }
+
+    aNbLine += 5;
+
+    // add triangle
+    aMergeTool.AddTriangle (aVertex);
+
+    readBufferLine (aPos, anEnd); // skip "endloop"
+    readBufferLine (aPos, anEnd); // skip "endfacet"
+
+    aNbLine += 2;
+  }
+
+  return aPS.More();
+}
+
 //==============================================================================
 //function : ReadAscii
 //purpose  :
@@ -296,6 +986,37 @@ Standard_Boolean RWStl_Reader::ReadAscii (Standard_IStream& theStream,
   // use method seekpos() to get true 64-bit offset to enable
   // handling of large files (VS 2010 64-bit)
   const int64_t aStartPos = GETPOS(theStream.tellg());
+
+  // try buffering the entire text in memory and parsing it by in-place pointer scan,
+  // which avoids per-line copying into the intermediate line buffer;
+  // engaged only while theBuffer holds no data read ahead of the stream position
+  // (data pending from the previous solid in multi-domain case)
+  const int64_t aNbBytes64 = GETPOS(theUntilPos) - aStartPos;
+  if (theBuffer.IsBufferEmpty()
+   && aNbBytes64 > 0
+   && aNbBytes64 <= int64_t(THE_STL_ASCII_BULK_BUFFER_SIZE))
+  {
+    // extra zero padding serves as sentinel for the last line
+    // and keeps 8-byte keyword loads within the allocation
+    std::vector<char> aBulkBuffer (size_t(aNbBytes64) + 8, '\0');
+    if (theStream.read (aBulkBuffer.data(), std::streamsize(aNbBytes64)))
+    {
+      size_t aConsumed = 0;
+      if (!readAsciiBuffered (*this, aBulkBuffer.data(), size_t(aNbBytes64), aConsumed, theProgress))
+      {
+        return false;
+      }
+      // position the stream right after the consumed portion ("endsolid" line)
+      // for reading the next solid in multi-domain case
+      theStream.clear();
+      theStream.seekg (std::streampos(aStartPos + int64_t(aConsumed)), std::ios::beg);
+      return true;
+    }
+    // bulk read failed - fall back to line-by-line reading
+    theStream.clear();
+    theStream.seekg (std::streampos(aStartPos), std::ios::beg);
+  }
+
   size_t aLineLen = 0;
   const char* aLine;
 
@@ -312,9 +1033,20 @@ Standard_Boolean RWStl_Reader::ReadAscii (Standard_IStream& theStream,
     return false;
   }
 
-  MergeNodeTool aMergeTool (this);
+  // conservative estimation of the number of facets from the portion size
+  // (a facet block occupies ~300 bytes of well-formatted text)
+  const int64_t aNbFacetsEstimate64 = (GETPOS(theUntilPos) - aStartPos) / 300;
+  const Standard_Integer aNbFacetsEstimate = aNbFacetsEstimate64 < int64_t(IntegerLast())
+                                           ? Standard_Integer(aNbFacetsEstimate64)
+                                           : IntegerLast();
+
+  MergeNodeTool aMergeTool (this, aNbFacetsEstimate > 0 ? aNbFacetsEstimate : -1);
   aMergeTool.SetMergeAngle (myMergeAngle);
   aMergeTool.SetMergeTolerance (myMergeTolearance);
+  if (aNbFacetsEstimate > 0)
+  {
+    Reserve (aNbFacetsEstimate / 2, aNbFacetsEstimate);
+  }
 
   Standard_CLocaleSentry::clocale_t aLocale = Standard_CLocaleSentry::GetCLocale();
   (void)aLocale; // to avoid warning on GCC where it is actually not used
@@ -326,10 +1058,15 @@ Standard_Boolean RWStl_Reader::ReadAscii (Standard_IStream& theStream,
   Message_ProgressScope aPS (theProgress, "Reading text STL file", aNbSteps);
   int64_t aProgressPos = aStartPos + aStepB;
   int aNbLine = 1;
+  Standard_Integer aNbFacetRead = 0;
 
   while (aPS.More())
   {
-    if (GETPOS(theStream.tellg()) > aProgressPos)
+    // querying the stream position involves a virtual call -
+    // hoist it out of the per-facet path and check progress once per 256 facets,
+    // which is far more frequent than the 1 MiB progress granularity anyway
+    if ((++aNbFacetRead & 0xFF) == 0
+     && GETPOS(theStream.tellg()) > aProgressPos)
     {
       aPS.Next();
       aProgressPos += aStepB;
@@ -348,14 +1085,14 @@ Standard_Boolean RWStl_Reader::ReadAscii (Standard_IStream& theStream,
     }
     if (!str_starts_with (aLine, "facet", 5))
     {
-      Message::SendFail (TCollection_AsciiString ("Error: unexpected format of facet at line ") + (aNbLine + 1));
+      reportLineError ("Error: unexpected format of facet at line ", aNbLine + 1);
       return false;
     }
 
     aLine = theBuffer.ReadLine (theStream, aLineLen);  // "outer loop"
     if (aLine == NULL || !str_starts_with (aLine, "outer", 5))
     {
-      Message::SendFail (TCollection_AsciiString ("Error: unexpected format of facet at line ") + (aNbLine + 1));
+      reportLineError ("Error: unexpected format of facet at line ", aNbLine + 1);
       return false;
     }
 
@@ -369,13 +1106,12 @@ Standard_Boolean RWStl_Reader::ReadAscii (Standard_IStream& theStream,
         isEOF = true;
         break;
       }
-      gp_XYZ aReadVertex;
-      if (!ReadVertex (aLine, aReadVertex.ChangeCoord (1), aReadVertex.ChangeCoord (2), aReadVertex.ChangeCoord (3)))
+      // parse straight into the output array - gp_XYZ triple is contiguous double[9]
+      if (!ReadVertex (aLine, aVertex[i].ChangeCoord (1), aVertex[i].ChangeCoord (2), aVertex[i].ChangeCoord (3)))
       {
-        Message::SendFail (TCollection_AsciiString ("Error: cannot read vertex coordinates at line ") + aNbLine);
+        reportLineError ("Error: cannot read vertex coordinates at line ", aNbLine);
         return false;
       }
-      aVertex[i] = aReadVertex;
     }
 
     // stop reading if end of file is reached;
@@ -430,50 +1166,125 @@ Standard_Boolean RWStl_Reader::ReadBinary (Standard_IStream& theStream,
   // number of facets is stored as 32-bit integer at position 80
   const Standard_Integer aNbFacets = *(int32_t*)(aHeader + 80);
 
-  MergeNodeTool aMergeTool (this, aNbFacets);
+  // large payloads are merged in multiple threads when position-only merging
+  // is requested (zero merge tolerance, merge angle covering any angle -
+  // the same 0.01 cosine threshold as used by Poly_MergeNodesTool)
+  if (myMergeTolearance <= 0.0
+   && myMergeAngle > 0.0
+   && Cos (myMergeAngle) <= 0.01
+   && aNbFacets >= THE_STL_PARALLEL_MIN_NBFACETS
+   && size_t(aNbFacets) * THE_STL_SIZEOF_FACET <= THE_STL_PARALLEL_BUFFER_SIZE
+   && OSD_Parallel::NbLogicalProcessors() > 1)
+  {
+    return readBinaryParallel (*this, theStream, aNbFacets, theProgress);
+  }
+
+  // when no merging is requested, nodes are fed to the target model directly,
+  // so that the node map and index remapping are bypassed altogether
+  const bool toMergeNodes = myMergeAngle > 0.0 || myMergeTolearance > 0.0;
+  MergeNodeTool aMergeTool (this, toMergeNodes ? aNbFacets : -1);
   aMergeTool.SetMergeAngle (myMergeAngle);
   aMergeTool.SetMergeTolerance (myMergeTolearance);
+  if (aNbFacets > 0)
+  {
+    // ratio 1:2 (NbTriangles:MergedNodes) is expected for watertight meshes;
+    // without merging each facet emits its own 3 nodes
+    const int64_t aNbNodesHint = toMergeNodes ? int64_t(aNbFacets) / 2 : int64_t(aNbFacets) * 3;
+    Reserve (aNbNodesHint < int64_t(IntegerLast()) ? Standard_Integer(aNbNodesHint) : IntegerLast(), aNbFacets);
+  }
 
   // don't trust the number of triangles which is coded in the file
   // sometimes it is wrong, and with this technique we don't need to swap endians for integer
   Message_ProgressScope  aPS (theProgress, "Reading binary STL file", aNbFacets);
   Standard_Integer        aNbRead = 0;
 
-  // allocate buffer for 80 triangles
-  const int THE_CHUNK_NBFACETS = 80;
-  char aBuffer[THE_STL_SIZEOF_FACET * THE_CHUNK_NBFACETS];
+  // allocate buffer for the whole payload (bounded, as the facet number
+  // stored in the header cannot be trusted to drive memory allocation)
+  const Standard_Integer aChunkNbFacets = Min (aNbFacets, Standard_Integer(THE_STL_BULK_BUFFER_SIZE / THE_STL_SIZEOF_FACET));
+  std::vector<char> aBuffer (size_t(Max (aChunkNbFacets, 1)) * THE_STL_SIZEOF_FACET);
+
+  // overlap reading of the next chunk with decoding of the current one;
+  // engaged only when the payload does not fit into a single buffer
+  const bool toReadAhead = aNbFacets > aChunkNbFacets;
+  std::vector<char> aBufferAhead;
+  ReadChunkTask aReadTask;
+  OSD_Thread aReadThread (&readChunkThreadFunc);
+  bool isAheadRunning = false;
+  if (toReadAhead)
+  {
+    aBufferAhead.resize (aBuffer.size());
+  }
 
   // normal + 3 nodes + 2 extra bytes
   const size_t aVec3Size    = sizeof(float) * 3;
   const size_t aFaceDataLen = aVec3Size * 4 + 2;
-  const char*  aBufferPtr   = aBuffer;
-  Standard_Integer aNbFacesInBuffer = 0;
-  for (Standard_Integer aNbFacetRead = 0; aNbFacetRead < aNbFacets && aPS.More();
-       ++aNbFacetRead, ++aNbRead, --aNbFacesInBuffer, aBufferPtr += aFaceDataLen, aPS.Next())
+  for (Standard_Integer aChunkLower = 0; aChunkLower < aNbFacets && aPS.More(); aChunkLower += aChunkNbFacets)
   {
-    // read more data
-    if (aNbFacesInBuffer <= 0)
+    const Standard_Integer aNbFacesInBuffer = Min (aChunkNbFacets, aNbFacets - aChunkLower);
+    const std::streamsize  aDataToRead = std::streamsize(aNbFacesInBuffer) * aFaceDataLen;
+    bool isChunkRead = false;
+    if (isAheadRunning)
     {
-      aNbFacesInBuffer = Min (THE_CHUNK_NBFACETS, aNbFacets - aNbFacetRead);
-      const std::streamsize aDataToRead = aNbFacesInBuffer * aFaceDataLen;
-      if (theStream.read (aBuffer, aDataToRead).gcount() != aDataToRead)
+      // pick up the chunk prepared by the background thread
+      aReadThread.Wait();
+      isAheadRunning = false;
+      std::swap (aBuffer, aBufferAhead);
+      isChunkRead = aReadTask.IsDone;
+    }
+    else
+    {
+      isChunkRead = theStream.read (aBuffer.data(), aDataToRead).gcount() == aDataToRead;
+    }
+    if (!isChunkRead)
+    {
+      Message::SendFail ("Error: binary STL read failed");
+      return false;
+    }
+
+    // kick off reading of the next chunk while the current one is decoded;
+    // if the thread could not be started, the next iteration falls back to synchronous reading
+    const Standard_Integer aNbFacesAhead = Min (aChunkNbFacets, aNbFacets - (aChunkLower + aNbFacesInBuffer));
+    if (aNbFacesAhead > 0)
+    {
+      aReadTask.Stream  = &theStream;
+      aReadTask.Buffer  = aBufferAhead.data();
+      aReadTask.NbBytes = std::streamsize(aNbFacesAhead) * aFaceDataLen;
+      aReadTask.IsDone  = false;
+      isAheadRunning = aReadThread.Run (&aReadTask) == Standard_True;
+    }
+
+    const char* aBufferPtr = aBuffer.data();
+    if (toMergeNodes)
+    {
+      for (Standard_Integer aFacetIter = 0; aFacetIter < aNbFacesInBuffer && aPS.More();
+           ++aFacetIter, ++aNbRead, aBufferPtr += aFaceDataLen, aPS.Next())
       {
-        Message::SendFail ("Error: binary STL read failed");
-        return false;
+        // get points from buffer
+//      readStlFloatVec3 (aBufferPtr); // skip normal
+        gp_XYZ aTriNodes[3];
+        readStlFloatVec3x3 (aBufferPtr + aVec3Size, aTriNodes);
+        aMergeTool.AddTriangle (aTriNodes);
       }
-      aBufferPtr = aBuffer;
     }
-
-    // get points from buffer
-//    readStlFloatVec3 (aBufferPtr); // skip normal
-    gp_XYZ aTriNodes[3] =
+    else
     {
-      readStlFloatVec3 (aBufferPtr + aVec3Size),
-      readStlFloatVec3 (aBufferPtr + aVec3Size * 2),
-      readStlFloatVec3 (aBufferPtr + aVec3Size * 3)
-    };
-    aMergeTool.AddTriangle (aTriNodes);
+      // no-merge specialization keeping the decode loop free of hash lookups
+      for (Standard_Integer aFacetIter = 0; aFacetIter < aNbFacesInBuffer && aPS.More();
+           ++aFacetIter, ++aNbRead, aBufferPtr += aFaceDataLen, aPS.Next())
+      {
+        gp_XYZ aTriNodes[3];
+        readStlFloatVec3x3 (aBufferPtr + aVec3Size, aTriNodes);
+        const Standard_Integer aNode1 = AddNode (aTriNodes[0]);
+        const Standard_Integer aNode2 = AddNode (aTriNodes[1]);
+        const Standard_Integer aNode3 = AddNode (aTriNodes[2]);
+        AddTriangle (aNode1, aNode2, aNode3);
+      }
+    }
   }
 
+  if (isAheadRunning)
+  {
+    aReadThread.Wait();
+  }
   return aPS.More();
 }
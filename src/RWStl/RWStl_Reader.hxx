@@ -77,6 +77,19 @@ public:
 
 public:
 
+  //! Callback function to be implemented in descendant.
+  //! Reserves target model containers for the expected mesh size to avoid
+  //! incremental growth; the hints are estimations and can be exceeded.
+  //! Default implementation does nothing.
+  //! @param theNbNodesHint     expected number of nodes
+  //! @param theNbTrianglesHint expected number of triangles
+  virtual void Reserve (const Standard_Integer theNbNodesHint,
+                        const Standard_Integer theNbTrianglesHint)
+  {
+    (void )theNbNodesHint;
+    (void )theNbTrianglesHint;
+  }
+
   //! Callback function to be implemented in descendant.
   //! Should create new node with specified coordinates in the target model, and return its ID as integer.
   virtual Standard_Integer AddNode (const gp_XYZ& thePnt) = 0;
@@ -270,6 +270,14 @@ public:
     myToPutGapInMultiline = theToPutGap;
   }
 
+  //! Returns TRUE when the buffer holds no data read ahead of the stream position,
+  //! so that the stream can be consumed directly bypassing ReadLine().
+  bool IsBufferEmpty() const
+  {
+    return myBufferPos >= myBytesLastRead
+       && !myUseReadBufferLastStr;
+  }
+
 protected:
 
   //! Read from stl stream.
@@ -37,7 +37,8 @@
 // purpose :
 // =======================================================================
 DFBrowser_ItemBase::DFBrowser_ItemBase (TreeModel_ItemBasePtr theParent, const int theRow, const int theColumn)
-: TreeModel_ItemBase (theParent, theRow, theColumn), myModule (0), myIsUseAdditionalInfo (true)
+: TreeModel_ItemBase (theParent, theRow, theColumn), myModule (0), myIsUseAdditionalInfo (true),
+  myAttributeTypeRowsBuilt (false)
 {
 }
 
@@ -48,6 +49,8 @@ DFBrowser_ItemBase::DFBrowser_ItemBase (TreeModel_ItemBasePtr theParent, const i
 void DFBrowser_ItemBase::Reset()
 {
   setLabel (TDF_Label());
+  myAttributeTypeRows.clear();
+  myAttributeTypeRowsBuilt = false;
   TreeModel_ItemBase::Reset();
 }
 
@@ -139,6 +142,29 @@ TreeModel_ItemBasePtr DFBrowser_ItemBase::createChild (int theRow, int theColumn
   return anItem;
 }
 
+// =======================================================================
+// function : AttributeTypeRow
+// purpose :
+// =======================================================================
+int DFBrowser_ItemBase::AttributeTypeRow (const QString& theAttributeType)
+{
+  if (!myAttributeTypeRowsBuilt)
+  {
+    for (int aChildId = 0, aNbChildren = rowCount(); aChildId < aNbChildren; aChildId++)
+    {
+      DFBrowser_ItemPtr anItem = itemDynamicCast<DFBrowser_Item> (Child (aChildId, 0));
+      if (!anItem || !anItem->HasAttribute())
+        continue;
+      QString anAttributeInfo = anItem->GetAttributeInfo (Qt::DisplayRole).toString();
+      if (!myAttributeTypeRows.contains (anAttributeInfo))
+        myAttributeTypeRows.insert (anAttributeInfo, aChildId);
+    }
+    myAttributeTypeRowsBuilt = true;
+  }
+  QHash<QString, int>::const_iterator anIt = myAttributeTypeRows.constFind (theAttributeType);
+  return anIt != myAttributeTypeRows.constEnd() ? anIt.value() : -1;
+}
+
 // =======================================================================
 // function : SetUseAdditionalInfo
 // purpose :
@@ -21,6 +21,11 @@
 
 #include <inspector/TreeModel_ItemBase.hxx>
 
+#include <Standard_WarningsDisable.hxx>
+#include <QHash>
+#include <QString>
+#include <Standard_WarningsRestore.hxx>
+
 class DFBrowser_ItemBase;
 class DFBrowser_Module;
 typedef QExplicitlySharedDataPointer<DFBrowser_ItemBase> DFBrowser_ItemBasePtr;
@@ -48,6 +53,12 @@ public:
   //! \return the current module
   DFBrowser_Module* GetModule() const { return myModule; }
 
+  //! Returns the child row of the attribute item having the given display value.
+  //! The attribute type to row map is filled on the first request and cleared in Reset().
+  //! \param theAttributeType an attribute display value, obtained by Qt::DisplayRole of the child item
+  //! \return the child row position or -1 if no attribute child has this value
+  Standard_EXPORT int AttributeTypeRow (const QString& theAttributeType);
+
   //! Changes using of additional information in item. If it does not use additional info,
   //! it will not return extended text in initValue().
   //! \param theValue a new value
@@ -100,6 +111,8 @@ private:
   TDF_Label myLabel; //!< a label of the document, which contains child labels and attributes
   DFBrowser_Module* myModule; //!< the current module
   bool myIsUseAdditionalInfo; //!< if true, additional item info is shown in square brackets
+  QHash<QString, int> myAttributeTypeRows; //!< map of attribute display value to child row, filled on the first request
+  bool myAttributeTypeRowsBuilt; //!< true if myAttributeTypeRows has been filled for the current label
 };
 
 #endif
\ No newline at end of file
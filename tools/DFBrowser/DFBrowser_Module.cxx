@@ -25,6 +25,7 @@
 #include <inspector/DFBrowserPane_AttributePane.hxx>
 #include <inspector/DFBrowserPane_AttributePaneCreator.hxx>
 #include <inspector/DFBrowserPane_ItemRole.hxx>
+#include <inspector/DFBrowserPane_TNamingUsedShapes.hxx>
 #include <inspector/DFBrowserPane_Tools.hxx>
 
 #include <XCAFApp_Application.hxx>
@@ -64,6 +65,14 @@ void DFBrowser_Module::SetApplication (const Handle(TDocStd_Application)& theApp
 {
   myOCAFViewModel->Init (theApplication);
 
+  myAttributeInfoCache.clear();
+  if (myAttributeTypes.contains ("TNaming_UsedShapes"))
+  {
+    DFBrowserPane_TNamingUsedShapes* aUsedShapesPane =
+      dynamic_cast<DFBrowserPane_TNamingUsedShapes*> (myAttributeTypes["TNaming_UsedShapes"]);
+    if (aUsedShapesPane)
+      aUsedShapesPane->ClearSortedReferences();
+  }
   myPaneCreators.clear();
   RegisterPaneCreator (new DFBrowserPane_AttributePaneCreator());
 }
@@ -99,6 +108,16 @@ void DFBrowser_Module::UpdateTreeModel()
   aSelectionModel->clearSelection();
 
   emit beforeUpdateTreeModel();
+  // the caches are dropped wholesale: TDF provides no change notification here,
+  // so entries of unchanged labels cannot be told apart from modified ones
+  myAttributeInfoCache.clear();
+  if (myAttributeTypes.contains ("TNaming_UsedShapes"))
+  {
+    DFBrowserPane_TNamingUsedShapes* aUsedShapesPane =
+      dynamic_cast<DFBrowserPane_TNamingUsedShapes*> (myAttributeTypes["TNaming_UsedShapes"]);
+    if (aUsedShapesPane)
+      aUsedShapesPane->ClearSortedReferences();
+  }
   myOCAFViewModel->Reset();
   myOCAFViewModel->EmitLayoutChanged();
 
@@ -173,6 +192,19 @@ DFBrowserPane_AttributePaneAPI* DFBrowser_Module::GetAttributePane (Standard_CSt
 QVariant DFBrowser_Module::GetAttributeInfo (Handle(TDF_Attribute) theAttribute, DFBrowser_Module* theModule,
                                              int theRole, int theColumnId)
 {
+  // the pane info of an attribute is stable until the tree model is rebuilt, so the
+  // computed value is cached in the module to avoid pane dispatch on each view request
+  QHash<quint64, QVariant>* anAttributeCache = 0;
+  quint64 anInfoKey = 0;
+  if (theModule && !theAttribute.IsNull())
+  {
+    anInfoKey = ((quint64 )(quint32 )theColumnId << 32) | (quint32 )theRole;
+    anAttributeCache = &theModule->myAttributeInfoCache[theAttribute.get()];
+    QHash<quint64, QVariant>::const_iterator anInfoIt = anAttributeCache->constFind (anInfoKey);
+    if (anInfoIt != anAttributeCache->constEnd())
+      return anInfoIt.value();
+  }
+
   DFBrowserPane_AttributePane* anAttributePane = 0;
   if (!theAttribute.IsNull())
   {
@@ -197,6 +229,9 @@ QVariant DFBrowser_Module::GetAttributeInfo (Handle(TDF_Attribute) theAttribute,
                theColumnId);
   else
     aValue = DFBrowserPane_AttributePane::GetAttributeInfoByType (theAttribute->DynamicType()->Name(), theRole, theColumnId);
+
+  if (anAttributeCache)
+    anAttributeCache->insert (anInfoKey, aValue);
   return aValue;
 }
 
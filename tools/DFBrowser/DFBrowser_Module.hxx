@@ -28,7 +28,9 @@
 #include <TopoDS_Shape.hxx>
 
 #include <Standard_WarningsDisable.hxx>
+#include <QHash>
 #include <QObject>
+#include <QVariant>
 #include <Standard_WarningsRestore.hxx>
 
 class DFBrowserPane_AttributePaneAPI;
@@ -148,6 +150,9 @@ private:
   QMap<TCollection_AsciiString, DFBrowserPane_AttributePaneAPI*> myAttributeTypes; //!< container of created panes
   QList<DFBrowserPane_AttributePaneCreatorAPI*> myPaneCreators; //!< pane creators
   Handle(AIS_InteractiveContext) myExternalContext; //!< context that comes in initialize parameters
+  //! cache of values returned by GetAttributeInfo for an attribute by role and column,
+  //! cleared when the application is changed or the tree model is rebuilt
+  QHash<const TDF_Attribute*, QHash<quint64, QVariant> > myAttributeInfoCache;
 };
 
 #endif
@@ -0,0 +1,67 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef DFBrowser_OpenFileThread_H
+#define DFBrowser_OpenFileThread_H
+
+#include <Standard.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TDocStd_Application.hxx>
+
+#include <Standard_WarningsDisable.hxx>
+#include <QThread>
+#include <Standard_WarningsRestore.hxx>
+
+//! \class DFBrowser_OpenFileThread
+//! Opens an OCAF application for a file name outside of the GUI thread.
+//! The file reading may take a long time for STEP files, so it is performed in run(),
+//! the caller connects to the QThread finished() signal and takes the result
+//! by GetApplication() on the GUI thread.
+class DFBrowser_OpenFileThread : public QThread
+{
+  Q_OBJECT
+public:
+
+  //! Constructor
+  DFBrowser_OpenFileThread (QObject* theParent)
+  : QThread (theParent), myIsSTEPFileName (false) {}
+
+  //! Destructor
+  virtual ~DFBrowser_OpenFileThread() {}
+
+  //! Sets the name of the file to be opened on the next start()
+  //! \param theFileName a file name
+  void SetFileName (const TCollection_AsciiString& theFileName) { myFileName = theFileName; }
+
+  //! Returns the name of the processed file
+  const TCollection_AsciiString& GetFileName() const { return myFileName; }
+
+  //! Returns the opened application, it may be NULL if the file was not opened
+  const Handle(TDocStd_Application)& GetApplication() const { return myApplication; }
+
+  //! Returns true if the processed file is a STEP file
+  bool IsSTEPFileName() const { return myIsSTEPFileName; }
+
+protected:
+
+  //! Opens the application for the file name, performed in the separate thread
+  Standard_EXPORT virtual void run() Standard_OVERRIDE;
+
+private:
+
+  TCollection_AsciiString myFileName; //!< the name of the file to be opened
+  Handle(TDocStd_Application) myApplication; //!< the opened application
+  bool myIsSTEPFileName; //!< true if the file is recognized as a STEP file
+};
+
+#endif
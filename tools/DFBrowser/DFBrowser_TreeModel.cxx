@@ -23,6 +23,7 @@
 #include <inspector/DFBrowserPane_Tools.hxx>
 #include <NCollection_List.hxx>
 
+#include <TDF_Tool.hxx>
 #include <TDocStd_Application.hxx>
 #include <TDocStd_Document.hxx>
 #include <TNaming_Builder.hxx>
@@ -30,6 +31,7 @@
 
 #include <Standard_WarningsDisable.hxx>
 #include <QAbstractItemModel>
+#include <QVector>
 #include <Standard_WarningsRestore.hxx>
 
 // =======================================================================
@@ -81,6 +83,18 @@ void DFBrowser_TreeModel::Init (const Handle(TDocStd_Application)& theApplicatio
   EmitLayoutChanged();
 }
 
+// =======================================================================
+// function : Reset
+// purpose :
+// =======================================================================
+void DFBrowser_TreeModel::Reset()
+{
+  // the resolved labels point into the previous state of the documents, they are
+  // dropped together with the cached item values on each rebuild of the model
+  myEntryToLabel.clear();
+  TreeModel_ModelBase::Reset();
+}
+
 // =======================================================================
 // function : GetTDocStdApplication
 // purpose :
@@ -91,6 +105,98 @@ Handle(TDocStd_Application) DFBrowser_TreeModel::GetTDocStdApplication() const
   return aRootItem->GetApplication();
 }
 
+// =======================================================================
+// function : SetHighlighted
+// purpose :
+// =======================================================================
+void DFBrowser_TreeModel::SetHighlighted (const QModelIndexList& theIndices)
+{
+  if (theIndices == myHighlightedIndices)
+    return;
+
+  const QModelIndexList aPreviousIndices = myHighlightedIndices;
+  myHighlightedIndices = theIndices;
+
+  // notify the view only about the indices changing the highlight state:
+  // a layout change forces the view to rebuild all persistent indices and row geometry
+  QVector<int> aRoles;
+  aRoles.append (Qt::BackgroundRole);
+  for (QModelIndexList::const_iterator anIt = aPreviousIndices.constBegin(); anIt != aPreviousIndices.constEnd(); anIt++)
+  {
+    if (!myHighlightedIndices.contains (*anIt))
+      EmitDataChanged (*anIt, *anIt, aRoles, false);
+  }
+  for (QModelIndexList::const_iterator anIt = myHighlightedIndices.constBegin(); anIt != myHighlightedIndices.constEnd(); anIt++)
+  {
+    if (!aPreviousIndices.contains (*anIt))
+      EmitDataChanged (*anIt, *anIt, aRoles, false);
+  }
+}
+
+// =======================================================================
+// function : FindLabelByEntry
+// purpose :
+// =======================================================================
+TDF_Label DFBrowser_TreeModel::FindLabelByEntry (const TCollection_AsciiString& theEntry) const
+{
+  NCollection_List<TCollection_AsciiString> anEntries;
+  anEntries.Append (theEntry);
+  NCollection_List<TDF_Label> aLabels;
+  FindLabelsByEntries (anEntries, aLabels);
+  return !aLabels.IsEmpty() ? aLabels.First() : TDF_Label();
+}
+
+// =======================================================================
+// function : FindLabelsByEntries
+// purpose :
+// =======================================================================
+void DFBrowser_TreeModel::FindLabelsByEntries (const NCollection_List<TCollection_AsciiString>& theEntries,
+                                               NCollection_List<TDF_Label>& theLabels) const
+{
+  QList<TCollection_AsciiString> anEntries;
+  QList<TDF_Label> aLabels;
+  QList<int> anUnresolved; // positions of entries missed in the cache
+  for (NCollection_List<TCollection_AsciiString>::Iterator anEntryIt (theEntries); anEntryIt.More(); anEntryIt.Next())
+  {
+    QHash<QString, TDF_Label>::const_iterator aCacheIt = myEntryToLabel.constFind (anEntryIt.Value().ToCString());
+    if (aCacheIt == myEntryToLabel.constEnd())
+      anUnresolved.append (aLabels.size());
+    anEntries.append (anEntryIt.Value());
+    aLabels.append (aCacheIt != myEntryToLabel.constEnd() ? aCacheIt.value() : TDF_Label());
+  }
+
+  Handle(TDocStd_Application) anApplication = GetTDocStdApplication();
+  if (!anApplication.IsNull())
+  {
+    // a single pass over the documents: an entry is parsed per document only until
+    // the document containing it is met, following documents are not visited
+    for (Standard_Integer aDocId = 1, aNbDoc = anApplication->NbDocuments();
+         aDocId <= aNbDoc && !anUnresolved.isEmpty(); aDocId++)
+    {
+      Handle(TDocStd_Document) aDocument;
+      anApplication->GetDocument (aDocId, aDocument);
+
+      for (int anUnresolvedId = anUnresolved.size() - 1; anUnresolvedId >= 0; anUnresolvedId--)
+      {
+        const int aPosition = anUnresolved[anUnresolvedId];
+        TDF_Label aLabel;
+        TDF_Tool::Label (aDocument->GetData(), anEntries[aPosition].ToCString(), aLabel, Standard_False);
+        if (!aLabel.IsNull())
+        {
+          aLabels[aPosition] = aLabel;
+          anUnresolved.removeAt (anUnresolvedId);
+        }
+      }
+    }
+  }
+
+  for (int aPosition = 0; aPosition < aLabels.size(); aPosition++)
+  {
+    myEntryToLabel.insert (anEntries[aPosition].ToCString(), aLabels[aPosition]);
+    theLabels.Append (aLabels[aPosition]);
+  }
+}
+
 // =======================================================================
 // function : FindIndex
 // purpose :
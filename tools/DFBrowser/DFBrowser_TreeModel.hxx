@@ -21,6 +21,7 @@
 
 #include <NCollection_List.hxx>
 #include <Standard.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TDF_Label.hxx>
 #include <TDocStd_Application.hxx>
 
@@ -56,6 +57,10 @@ public:
   //! Fills the root item by the application
   Standard_EXPORT void Init (const Handle(TDocStd_Application)& theApplication);
 
+  //! Resets the cached values of items together with the entry to label cache,
+  //! the resolved labels are not valid after the model content change
+  Standard_EXPORT virtual void Reset() Standard_OVERRIDE;
+
   //! Fills root item by the module
   Standard_EXPORT void SetModule (DFBrowser_Module* theModule);
 
@@ -63,12 +68,30 @@ public:
   //! \return an application instance
   Standard_EXPORT Handle(TDocStd_Application) GetTDocStdApplication() const;
 
+  //! Returns a label of one of the application documents by the label entry.
+  //! The first request for an entry iterates the documents and parses the entry by TDF_Tool::Label,
+  //! the found label is stored in a cache, so the next requests are a hash find.
+  //! The cache is cleared in Reset() on each model rebuild.
+  //! \param theEntry a label entry
+  //! \return the found label, it may be Null if no document contains the entry
+  Standard_EXPORT TDF_Label FindLabelByEntry (const TCollection_AsciiString& theEntry) const;
+
+  //! Resolves several label entries in one pass over the application documents.
+  //! The entries missed in the cache are parsed per document until the containing document is met,
+  //! so the document iteration is not restarted for every entry as in FindLabelByEntry.
+  //! \param theEntries label entries to be resolved
+  //! \param theLabels the found labels in the order of the entries, Null for not found ones
+  Standard_EXPORT void FindLabelsByEntries (const NCollection_List<TCollection_AsciiString>& theEntries,
+                                            NCollection_List<TDF_Label>& theLabels) const;
+
   //! Returns true if the tree view model contains highlighted items. This highlight is set manually.
   bool HasHighlighted() { return !myHighlightedIndices.isEmpty(); }
 
   //! Sets items of the indices highlighted in the model.
+  //! Emits dataChanged only for the indices entering or leaving the highlight state,
+  //! so the view does not relayout the whole tree.
   //! \param theIndices a list of tree model indices
-  void SetHighlighted (const QModelIndexList& theIndices = QModelIndexList()) { myHighlightedIndices = theIndices; }
+  Standard_EXPORT void SetHighlighted (const QModelIndexList& theIndices = QModelIndexList());
 
   //! Returns tree model index of the label item. It creates container of the label fathers and
   //! starting from the rools label it descends by the found labels till the parameter label.
@@ -109,6 +132,7 @@ protected:
 private:
 
   QModelIndexList myHighlightedIndices; //!< tree model indices that should be visualized as highlighted
+  mutable QHash<QString, TDF_Label> myEntryToLabel; //!< cache of already resolved label entries, cleared in Reset()
 };
 
 #endif
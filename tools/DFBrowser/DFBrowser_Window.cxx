@@ -28,6 +28,7 @@
 #include <inspector/DFBrowser_ItemApplication.hxx>
 #include <inspector/DFBrowser_Module.hxx>
 #include <inspector/DFBrowser_OpenApplication.hxx>
+#include <inspector/DFBrowser_OpenFileThread.hxx>
 #include <inspector/DFBrowser_PropertyPanel.hxx>
 #include <inspector/DFBrowser_SearchLine.hxx>
 #include <inspector/DFBrowser_SearchView.hxx>
@@ -55,7 +56,6 @@
 #include <inspector/View_Viewer.hxx>
 #include <inspector/View_Window.hxx>
 
-#include <TDF_Tool.hxx>
 #include <inspector/ViewControl_MessageDialog.hxx>
 #include <inspector/ViewControl_Tools.hxx>
 
@@ -96,7 +96,8 @@ static Standard_Boolean MyIsUseDumpJson = Standard_False;
 // purpose :
 // =======================================================================
 DFBrowser_Window::DFBrowser_Window()
-: myModule (0), myParent (0), myPropertyPanel (0), myExportToShapeViewDialog (0)
+: myModule (0), myOCAFTreeModel (0), myParent (0), myPropertyPanel (0), myExportToShapeViewDialog (0),
+  myOpenFileThread (0)
 {
   myMainWindow = new QMainWindow (0);
 
@@ -110,6 +111,8 @@ DFBrowser_Window::DFBrowser_Window()
                                                                  DFBROWSER_DEFAULT_TREE_VIEW_HEIGHT));
   myTreeView->setHeaderHidden (true);
   myTreeView->setSortingEnabled (Standard_False);
+  // all rows have the same height, it allows the view to avoid per-row geometry requests
+  myTreeView->setUniformRowHeights (true);
   myMainWindow->setCentralWidget (myTreeView);
 
 #if QT_VERSION < 0x050000
@@ -118,6 +121,10 @@ DFBrowser_Window::DFBrowser_Window()
   myTreeView->setStyle (QStyleFactory::create("Windows"));
 #endif
 
+  mySelectionProcessTimer.setSingleShot (true);
+  mySelectionProcessTimer.setInterval (0);
+  connect (&mySelectionProcessTimer, SIGNAL (timeout()), this, SLOT (onProcessTreeViewSelectionChanged()));
+
   myTreeLevelLine = new DFBrowser_TreeLevelLine (myMainWindow);
   connect (myTreeLevelLine->GetSearchLine(), SIGNAL (searchActivated()), this, SLOT (onSearchActivated()));
   connect (myTreeLevelLine, SIGNAL (indexSelected (const QModelIndex&)),
@@ -215,6 +222,9 @@ DFBrowser_Window::DFBrowser_Window()
 // =======================================================================
 DFBrowser_Window::~DFBrowser_Window()
 {
+  // a file might still be opened in the background, destroying a running thread is fatal
+  if (myOpenFileThread)
+    myOpenFileThread->wait();
   delete myModule;
 }
 
@@ -313,32 +323,40 @@ void DFBrowser_Window::UpdateContent()
   }
   onUpdateClicked();
 
-  // make parameter items selected if defined
+  // make parameter items selected if defined; while a file is being opened in the
+  // background the model is still empty, the selected names are kept in the parameters
+  // and the restore is replayed from onOpenFileFinished()
+  if (myOpenFileThread == NULL || !myOpenFileThread->isRunning())
+    restoreParameterSelection();
+}
+
+// =======================================================================
+// function : restoreParameterSelection
+// purpose :
+// =======================================================================
+void DFBrowser_Window::restoreParameterSelection()
+{
+  TCollection_AsciiString aName = "TKDFBrowser";
   if (myParameters->FindSelectedNames(aName))
   {
     const NCollection_List<TCollection_AsciiString>& aSelected = myParameters->GetSelectedNames (aName);
 
-    DFBrowser_TreeModel* aTreeModel = dynamic_cast<DFBrowser_TreeModel*> (myTreeView->model());
-    Handle(TDocStd_Application) anApplication = aTreeModel->GetTDocStdApplication();
+    DFBrowser_TreeModel* aTreeModel = myOCAFTreeModel;
 
     QItemSelectionModel* aSelectionModel = myTreeView->selectionModel();
+    // the clear and select changes are processed manually below by one call,
+    // not to update the dependent controls on each of them
+    const QItemSelection aPreviousSelection = aSelectionModel->selection();
+    const bool aWereBlocked = aSelectionModel->blockSignals (true);
     aSelectionModel->clear();
 
+    QModelIndex aSelectedIndex;
     NCollection_List<TCollection_AsciiString>::Iterator aSelectedIt (aSelected);
     if (aSelectedIt.More())
     {
       TCollection_AsciiString aLabelEntry = aSelectedIt.Value();
 
-      TDF_Label aLabel;
-      for (Standard_Integer aDocId = 1, aNbDoc = anApplication->NbDocuments(); aDocId <= aNbDoc; aDocId++)
-      {
-        Handle(TDocStd_Document) aDocument;
-        anApplication->GetDocument (aDocId, aDocument);
-
-        TDF_Tool::Label(aDocument->GetData(), aLabelEntry.ToCString(), aLabel, Standard_False);
-        if (!aLabel.IsNull())
-          break;
-      }
+      TDF_Label aLabel = aTreeModel->FindLabelByEntry (aLabelEntry);
       if (!aLabel.IsNull())
       {
         QModelIndex anIndexToBeSelected = aTreeModel->FindIndex (aLabel);
@@ -350,31 +368,28 @@ void DFBrowser_Window::UpdateContent()
         {
           anAttributeType = aSelectedIt.Value();
 
-          TreeModel_ItemBasePtr aLabelItem = TreeModel_ModelBase::GetItemByIndex (anIndexToBeSelected);
-          //DFBrowser_ItemPtr anItem = itemDynamicCast<DFBrowser_Item> (anItemBase);
-          for (int aChildId = 0, aNbChildren = aLabelItem->rowCount(); aChildId < aNbChildren; aChildId++)
+          DFBrowser_ItemBasePtr aLabelItem = itemDynamicCast<DFBrowser_ItemBase> (
+            TreeModel_ModelBase::GetItemByIndex (anIndexToBeSelected));
+          if (aLabelItem)
           {
-            QModelIndex anIndex = aTreeModel->index (aChildId, 0, anIndexToBeSelected);
-            TreeModel_ItemBasePtr anItemBase = TreeModel_ModelBase::GetItemByIndex (anIndex);
-            DFBrowser_ItemPtr anItem = itemDynamicCast<DFBrowser_Item> (anItemBase);
-            if (anItem->HasAttribute())
-            {
-              // processing attribute in theValue
-              DFBrowser_ItemApplicationPtr aRootAppItem = itemDynamicCast<DFBrowser_ItemApplication>(aTreeModel->RootItem (0));
-              QString anAttributeInfo = DFBrowser_Module::GetAttributeInfo (anItem->GetAttribute(), aRootAppItem->GetModule(),
-                                                      Qt::DisplayRole, 0).toString();
-              if (anAttributeInfo == anAttributeType.ToCString())
-              {
-                anIndexToBeSelected = anIndex;
-                break;
-              }
-            }
+            // find the attribute row in the map of attribute display values cached on the label item
+            int anAttributeRow = aLabelItem->AttributeTypeRow (anAttributeType.ToCString());
+            if (anAttributeRow >= 0)
+              anIndexToBeSelected = aTreeModel->index (anAttributeRow, 0, anIndexToBeSelected);
           }
         }
         aSelectionModel->select (anIndexToBeSelected, QItemSelectionModel::Select);
         myTreeView->scrollTo (anIndexToBeSelected);
+        aSelectedIndex = anIndexToBeSelected;
       }
     }
+    aSelectionModel->blockSignals (aWereBlocked);
+    if (aSelectedIndex.isValid())
+      onModelSelectionChanged (QItemSelection (aSelectedIndex, aSelectedIndex), QItemSelection());
+    else
+      // nothing was resolved to be selected, the dependent controls are still told
+      // about the blocked clear not to keep the previous selection content
+      onModelSelectionChanged (QItemSelection(), aPreviousSelection);
 
     myParameters->SetSelectedNames(aName, NCollection_List<TCollection_AsciiString>());
   }
@@ -389,9 +404,8 @@ void DFBrowser_Window::Init (const NCollection_List<Handle(Standard_Transient)>&
   Handle(TDocStd_Application) anApplication;
   if (myModule)
   {
-    DFBrowser_TreeModel* anOCAFViewModel = dynamic_cast<DFBrowser_TreeModel*> (myModule->GetOCAFViewModel());
-    if (anOCAFViewModel)
-      anApplication = anOCAFViewModel->GetTDocStdApplication();
+    if (myOCAFTreeModel)
+      anApplication = myOCAFTreeModel->GetTDocStdApplication();
   }
   Handle(AIS_InteractiveContext) aContext;
   if (myModule)
@@ -429,6 +443,10 @@ void DFBrowser_Window::Init (const NCollection_List<Handle(Standard_Transient)>&
     return;
   }
 
+  // the cached presentations are keyed by item pointers of the previous OCAF tree
+  // model, they are dropped together with the model the module is replaced with
+  myPresentationCache.clear();
+
   myModule = new DFBrowser_Module();
   myModule->CreateViewModel (myMainWindow);
 
@@ -450,10 +468,10 @@ void DFBrowser_Window::Init (const NCollection_List<Handle(Standard_Transient)>&
   }
 
   myModule->SetApplication (anApplication);
-  //! expand first three levels: CUSTOM
-  QModelIndex aParentIndex = aModel->index (0, 0);
-  setExpandedLevels (myTreeView, aParentIndex, 3/*levels*/);
-  
+  // expand only the application item: the deeper items are built by the model
+  // on demand when the user expands their parent
+  myTreeView->expand (aModel->index (0, 0));
+
   myModule->SetInitialTreeViewSelection();
 }
 
@@ -463,6 +481,18 @@ void DFBrowser_Window::Init (const NCollection_List<Handle(Standard_Transient)>&
 // =======================================================================
 void DFBrowser_Window::OpenFile (const TCollection_AsciiString& theFileName)
 {
+  if (myOpenFileThread && myOpenFileThread->isRunning())
+    return; // another file is being opened
+
+  // reopening the currently loaded file: refresh the tree model instead of
+  // closing the documents and parsing the file once again
+  if (!myOpenedFilePath.IsEmpty() && myOpenedFilePath.IsEqual (theFileName)
+   && !myModule->GetTDocStdApplication().IsNull())
+  {
+    myModule->UpdateTreeModel();
+    return;
+  }
+
   QApplication::setOverrideCursor (Qt::WaitCursor);
 
   myTreeLevelLine->ClearHistory();
@@ -476,8 +506,8 @@ void DFBrowser_Window::OpenFile (const TCollection_AsciiString& theFileName)
 
   myTreeLevelLine->ClearHistory();
 
-  DFBrowser_TreeModel* anOCAFViewModel = dynamic_cast<DFBrowser_TreeModel*> (myModule->GetOCAFViewModel());
-  anOCAFViewModel->Reset();
+  myOCAFTreeModel->Reset();
+  myPresentationCache.clear();
 
   //! close previous documents to open new document
   Handle(TDocStd_Application) anApplication = myModule->GetTDocStdApplication();
@@ -492,29 +522,53 @@ void DFBrowser_Window::OpenFile (const TCollection_AsciiString& theFileName)
     }
   }
 
-  //! open new document
-  bool isSTEPFileName = false;
-  anApplication = DFBrowser_OpenApplication::OpenApplication (theFileName, isSTEPFileName);
-  
+  //! open new document in a separate thread: the file reading may take a long time
+  //! for STEP files, so the GUI thread is not blocked. The opened application is
+  //! installed into the module in onOpenFileFinished() on the GUI thread.
+  if (!myOpenFileThread)
+  {
+    myOpenFileThread = new DFBrowser_OpenFileThread (this);
+    connect (myOpenFileThread, SIGNAL (finished()), this, SLOT (onOpenFileFinished()));
+  }
+  myOpenFileThread->SetFileName (theFileName);
+  myOpenFileThread->start();
+}
+
+// =======================================================================
+// function : onOpenFileFinished
+// purpose :
+// =======================================================================
+void DFBrowser_Window::onOpenFileFinished()
+{
+  const TCollection_AsciiString aFileName = myOpenFileThread->GetFileName();
+  const bool isSTEPFileName = myOpenFileThread->IsSTEPFileName();
+  Handle(TDocStd_Application) anApplication = myOpenFileThread->GetApplication();
+
   if (myParent)
-    myParent->setObjectName (isSTEPFileName ? QString (TCollection_AsciiString (theFileName).ToCString()) : getWindowTitle());
+    myParent->setObjectName (isSTEPFileName ? QString (aFileName.ToCString()) : getWindowTitle());
   else
-    myOpenedFileName = isSTEPFileName ? QString(TCollection_AsciiString(theFileName).ToCString()) : getWindowTitle();
+    myOpenedFileName = isSTEPFileName ? QString (aFileName.ToCString()) : getWindowTitle();
 
   if (anApplication.IsNull())
   {
+    myOpenedFilePath.Clear();
     QApplication::restoreOverrideCursor();
     QMessageBox::information (0, "Error", QString ("File %1 can't be opened by OCAF application")
-                                                   .arg(TCollection_AsciiString (theFileName).ToCString()));
+                                                   .arg (aFileName.ToCString()));
   }
   else {
+    myOpenedFilePath = aFileName;
     myModule->SetApplication (anApplication);
-    //! expand first three levels: CUSTOM
-    QModelIndex aParentIndex = anOCAFViewModel->index (0, 0);
-    setExpandedLevels (myTreeView, aParentIndex, 3/*levels*/);
+    // expand only the application item: the deeper items are built by the model
+    // on demand when the user expands their parent
+    myTreeView->expand (myOCAFTreeModel->index (0, 0));
 
     myModule->SetInitialTreeViewSelection();
     QApplication::restoreOverrideCursor();
+
+    // replay the selection restore postponed in UpdateContent() for the file
+    // opened in the background
+    restoreParameterSelection();
   }
 }
 
@@ -524,11 +578,10 @@ void DFBrowser_Window::OpenFile (const TCollection_AsciiString& theFileName)
 // =======================================================================
 QString DFBrowser_Window::getWindowTitle() const
 {
-  DFBrowser_TreeModel* anOCAFViewModel = dynamic_cast<DFBrowser_TreeModel*> (myModule->GetOCAFViewModel());
-  if (!anOCAFViewModel)
+  if (!myOCAFTreeModel)
     return "";
 
-  Handle(TDocStd_Application) anApplication = anOCAFViewModel->GetTDocStdApplication();
+  Handle(TDocStd_Application) anApplication = myOCAFTreeModel->GetTDocStdApplication();
   if (anApplication.IsNull() || anApplication->NbDocuments() == 0)
     return "";
 
@@ -540,41 +593,34 @@ QString DFBrowser_Window::getWindowTitle() const
   return DFBrowserPane_Tools::ToString (aDocument->GetPath());
 }
 
-// =======================================================================
-// function : setExpandedLevels
-// purpose :
-// =======================================================================
-void DFBrowser_Window::setExpandedLevels (QTreeView* theTreeView, const QModelIndex& theParentIndex, const int theLevels)
-{
-  if (theLevels <= 0)
-    return;
-
-  QAbstractItemModel* aModel = theTreeView->model();
-  if (!aModel)
-    return;
-
-  theTreeView->setExpanded (theParentIndex, true);
-  for (int aRowId = 0, aRows = aModel->rowCount (theParentIndex); aRowId < aRows; aRowId++)
-    setExpandedLevels (theTreeView, aModel->index (aRowId, 0, theParentIndex), theLevels - 1);
-}
-
 // =======================================================================
 // function : setOCAFModel
 // purpose :
 // =======================================================================
 void DFBrowser_Window::setOCAFModel (QAbstractItemModel* theModel)
 {
+  myOCAFTreeModel = dynamic_cast<DFBrowser_TreeModel*> (theModel);
   myTreeView->setModel (theModel);
 
   QItemSelectionModel* aSelectionModel = new QItemSelectionModel (theModel);
   myTreeView->setSelectionModel (aSelectionModel);
 
+  // a single connection: the consumers are called directly in onModelSelectionChanged
+  // instead of three separate signal dispatches per selection event
   connect (aSelectionModel, SIGNAL (selectionChanged (const QItemSelection&, const QItemSelection&)),
-           myTreeLevelLine, SLOT (OnTreeViewSelectionChanged (const QItemSelection&, const QItemSelection&)));
-  connect(aSelectionModel, SIGNAL (selectionChanged (const QItemSelection&, const QItemSelection&)),
-          myDumpView, SLOT (OnTreeViewSelectionChanged (const QItemSelection&, const QItemSelection&)));
-  connect (aSelectionModel, SIGNAL (selectionChanged (const QItemSelection&, const QItemSelection&)),
-           this, SLOT (onTreeViewSelectionChanged (const QItemSelection&, const QItemSelection&)));
+           this, SLOT (onModelSelectionChanged (const QItemSelection&, const QItemSelection&)));
+}
+
+// =======================================================================
+// function : onModelSelectionChanged
+// purpose :
+// =======================================================================
+void DFBrowser_Window::onModelSelectionChanged (const QItemSelection& theSelected,
+                                                const QItemSelection& theDeselected)
+{
+  myTreeLevelLine->OnTreeViewSelectionChanged (theSelected, theDeselected);
+  myDumpView->OnTreeViewSelectionChanged (theSelected, theDeselected);
+  onTreeViewSelectionChanged (theSelected, theDeselected);
 }
 
 // =======================================================================
@@ -584,13 +630,23 @@ void DFBrowser_Window::setOCAFModel (QAbstractItemModel* theModel)
 void DFBrowser_Window::onBeforeUpdateTreeModel()
 {
   myTreeLevelLine->ClearHistory();
+  myPresentationCache.clear();
+  // selection changes accumulated before the rebuild keep indices of the previous
+  // model state, they should not reach the controls after the reset
+  mySelectionProcessTimer.stop();
+  mySelectedAccumulated.clear();
+  myDeselectedAccumulated.clear();
 }
 
 // =======================================================================
 // function : TmpDirectory
 // purpose :
 // =======================================================================
-TCollection_AsciiString DFBrowser_Window::TmpDirectory()
+// =======================================================================
+// function : tmpDirectory
+// purpose : environment lookup and directory creation behind TmpDirectory()
+// =======================================================================
+static TCollection_AsciiString tmpDirectory()
 {
   TCollection_AsciiString aTmpDir;
 #ifdef _WIN32
@@ -617,6 +673,18 @@ TCollection_AsciiString DFBrowser_Window::TmpDirectory()
   return aTmpDir;
 }
 
+// =======================================================================
+// function : TmpDirectory
+// purpose :
+// =======================================================================
+TCollection_AsciiString DFBrowser_Window::TmpDirectory()
+{
+  // the temporary directory is constant for the process lifetime, so the environment
+  // lookup and the directory creation are performed only on the first call
+  static const TCollection_AsciiString aTmpDir = tmpDirectory();
+  return aTmpDir;
+}
+
 // =======================================================================
 // function : SetUseDumpJson
 // purpose :
@@ -665,12 +733,17 @@ void DFBrowser_Window::onExpand()
   QApplication::setOverrideCursor (Qt::WaitCursor);
 
   QItemSelectionModel* aSelectionModel = myTreeView->selectionModel();
-  QModelIndexList aSelectedIndices = aSelectionModel->selectedIndexes();
-  for (int aSelectedId = 0, aSize = aSelectedIndices.size(); aSelectedId < aSize; aSelectedId++)
+  const QModelIndexList aSelectedIndices = aSelectionModel->selectedIndexes();
+  myTreeView->setUpdatesEnabled (false);
+  const bool aWereBlocked = myTreeView->blockSignals (true);
+  for (const QModelIndex& aSelectedIndex : aSelectedIndices)
   {
     int aLevels = 2;
-    TreeModel_Tools::SetExpanded (myTreeView, aSelectedIndices[aSelectedId], true, aLevels);
+    TreeModel_Tools::SetExpanded (myTreeView, aSelectedIndex, true, aLevels);
   }
+  myTreeView->blockSignals (aWereBlocked);
+  myTreeView->setUpdatesEnabled (true);
+  myTreeView->viewport()->update();
   QApplication::restoreOverrideCursor();
 }
 
@@ -683,12 +756,17 @@ void DFBrowser_Window::onExpandAll()
   QApplication::setOverrideCursor (Qt::WaitCursor);
 
   QItemSelectionModel* aSelectionModel = myTreeView->selectionModel();
-  QModelIndexList aSelectedIndices = aSelectionModel->selectedIndexes();
-  for (int  aSelectedId = 0, aSize = aSelectedIndices.size(); aSelectedId < aSize; aSelectedId++)
+  const QModelIndexList aSelectedIndices = aSelectionModel->selectedIndexes();
+  myTreeView->setUpdatesEnabled (false);
+  const bool aWereBlocked = myTreeView->blockSignals (true);
+  for (const QModelIndex& aSelectedIndex : aSelectedIndices)
   {
     int aLevels = -1;
-    TreeModel_Tools::SetExpanded (myTreeView, aSelectedIndices[aSelectedId], true, aLevels);
+    TreeModel_Tools::SetExpanded (myTreeView, aSelectedIndex, true, aLevels);
   }
+  myTreeView->blockSignals (aWereBlocked);
+  myTreeView->setUpdatesEnabled (true);
+  myTreeView->viewport()->update();
   QApplication::restoreOverrideCursor();
 }
 
@@ -699,11 +777,16 @@ void DFBrowser_Window::onExpandAll()
 void DFBrowser_Window::onCollapseAll()
 {
   QItemSelectionModel* aSelectionModel = myTreeView->selectionModel();
-  QModelIndexList aSelectedIndices = aSelectionModel->selectedIndexes();
-  for (int aSelectedId = 0, aSize = aSelectedIndices.size(); aSelectedId < aSize; aSelectedId++) {
+  const QModelIndexList aSelectedIndices = aSelectionModel->selectedIndexes();
+  myTreeView->setUpdatesEnabled (false);
+  const bool aWereBlocked = myTreeView->blockSignals (true);
+  for (const QModelIndex& aSelectedIndex : aSelectedIndices) {
     int aLevels = -1;
-    TreeModel_Tools::SetExpanded (myTreeView, aSelectedIndices[aSelectedId], false, aLevels);
+    TreeModel_Tools::SetExpanded (myTreeView, aSelectedIndex, false, aLevels);
   }
+  myTreeView->blockSignals (aWereBlocked);
+  myTreeView->setUpdatesEnabled (true);
+  myTreeView->viewport()->update();
 }
 
 // =======================================================================
@@ -727,6 +810,24 @@ void DFBrowser_Window::onUseDumpJson()
 void DFBrowser_Window::onTreeViewSelectionChanged (const QItemSelection& theSelected,
                                                    const QItemSelection& theDeselected)
 {
+  // a selection change often comes in bursts (clear followed by select), so the changes
+  // are accumulated and processed once when the control returns to the event loop
+  mySelectedAccumulated.merge (theSelected, QItemSelectionModel::Select);
+  myDeselectedAccumulated.merge (theDeselected, QItemSelectionModel::Select);
+  mySelectionProcessTimer.start();
+}
+
+// =======================================================================
+// function : onProcessTreeViewSelectionChanged
+// purpose :
+// =======================================================================
+void DFBrowser_Window::onProcessTreeViewSelectionChanged()
+{
+  const QItemSelection aSelected = mySelectedAccumulated;
+  const QItemSelection aDeselected = myDeselectedAccumulated;
+  mySelectedAccumulated.clear();
+  myDeselectedAccumulated.clear();
+
   if (!myModule)
     return;
 
@@ -739,10 +840,10 @@ void DFBrowser_Window::onTreeViewSelectionChanged (const QItemSelection& theSele
   DFBrowser_AttributePaneStack* anAttributePaneStack = myPropertyPanel->GetAttributesStack();
   anAttributePaneStack->GetPaneSelector()->ClearSelected();
 
-  myPropertyPanel->UpdateBySelectionChanged (theSelected, theDeselected);
-  anAttributePaneStack->GetTreeLevelView()->UpdateByTreeSelectionChanged (theSelected, theDeselected);
+  myPropertyPanel->UpdateBySelectionChanged (aSelected, aDeselected);
+  anAttributePaneStack->GetTreeLevelView()->UpdateByTreeSelectionChanged (aSelected, aDeselected);
 
-  QModelIndexList aSelectedIndices = theSelected.indexes();
+  QModelIndexList aSelectedIndices = aSelected.indexes();
   QModelIndex aSelectedIndex = TreeModel_ModelBase::SingleSelected (aSelectedIndices, 0);
 
   myTreeView->scrollTo (aSelectedIndex);
@@ -832,7 +933,7 @@ void DFBrowser_Window::onPaneSelectionChanged (const QItemSelection&,
   Handle(Standard_Transient) aPresentation;
   anAttributePane->GetReferences (anAttribute, aReferences, aPresentation);
   QModelIndexList anIndices;
-  DFBrowser_TreeModel* aTreeModel = dynamic_cast<DFBrowser_TreeModel*> (myTreeView->model());
+  DFBrowser_TreeModel* aTreeModel = myOCAFTreeModel;
   if (!aReferences.IsEmpty())
     aTreeModel->ConvertToIndices (aReferences, anIndices);
   else {
@@ -885,8 +986,7 @@ void DFBrowser_Window::onUpdateClicked()
 // =======================================================================
 void DFBrowser_Window::onSearchPathSelected (const QStringList& thePath, const QString& theValue)
 {
-  DFBrowser_TreeModel* aDFBrowserModel = dynamic_cast<DFBrowser_TreeModel*> (myTreeView->model());
-  const QModelIndex& anIndex = aDFBrowserModel->FindIndexByPath (thePath, theValue);
+  const QModelIndex& anIndex = myOCAFTreeModel->FindIndexByPath (thePath, theValue);
 
   if (anIndex.isValid())
   {
@@ -902,8 +1002,7 @@ void DFBrowser_Window::onSearchPathSelected (const QStringList& thePath, const Q
 // =======================================================================
 void DFBrowser_Window::onSearchPathDoubleClicked (const QStringList& thePath, const QString& theValue)
 {
-  DFBrowser_TreeModel* aDFBrowserModel = dynamic_cast<DFBrowser_TreeModel*> (myTreeView->model());
-  const QModelIndex& anIndex = aDFBrowserModel->FindIndexByPath (thePath, theValue);
+  const QModelIndex& anIndex = myOCAFTreeModel->FindIndexByPath (thePath, theValue);
 
   QItemSelectionModel* aSelectionModel = myTreeView->selectionModel();
   if (anIndex.isValid())
@@ -948,11 +1047,7 @@ void DFBrowser_Window::onLevelDoubleClicked (const QModelIndex& theIndex)
 // =======================================================================
 void DFBrowser_Window::highlightIndices (const QModelIndexList& theIndices)
 {
-  QAbstractItemModel* aModel = myTreeView->model();
-  if (!aModel)
-    return;
-
-  DFBrowser_TreeModel* aTreeModel = dynamic_cast<DFBrowser_TreeModel*> (aModel);
+  DFBrowser_TreeModel* aTreeModel = myOCAFTreeModel;
   if (!aTreeModel)
     return;
 
@@ -974,8 +1069,6 @@ void DFBrowser_Window::highlightIndices (const QModelIndexList& theIndices)
 
   if (theIndices.isEmpty())
     myTreeView->setFocus(); // to see the selected item in active palette color
-
-  aTreeModel->EmitLayoutChanged();
 }
 
 // =======================================================================
@@ -984,16 +1077,7 @@ void DFBrowser_Window::highlightIndices (const QModelIndexList& theIndices)
 // =======================================================================
 Handle(AIS_InteractiveObject) DFBrowser_Window::findPresentation (const QModelIndex& theIndex)
 {
-  Handle(AIS_InteractiveObject) aPresentation;
-
-  QModelIndexList anIndices;
-  anIndices.append (theIndex);
-  AIS_ListOfInteractive aDisplayed;
-  findPresentations (anIndices, aDisplayed);
-  if (!aDisplayed.IsEmpty())
-    aPresentation = aDisplayed.First();
-
-  return aPresentation;
+  return findPresentationImpl (theIndex);
 }
 
 // =======================================================================
@@ -1002,23 +1086,39 @@ Handle(AIS_InteractiveObject) DFBrowser_Window::findPresentation (const QModelIn
 // =======================================================================
 void DFBrowser_Window::findPresentations (const QModelIndexList& theIndices, AIS_ListOfInteractive& thePresentations)
 {
-  for (int anIndexId = 0, aCount = theIndices.size(); anIndexId < aCount; anIndexId++)
+  for (const QModelIndex& anIndex : theIndices)
   {
-    Handle(AIS_InteractiveObject) aPresentation;
-    Handle(TDF_Attribute) anAttribute = myModule->FindAttribute (theIndices[anIndexId]);
-    if (anAttribute.IsNull())
-      continue;
-    DFBrowserPane_AttributePaneAPI* anAttributePane = myModule->GetAttributePane (anAttribute);
-    if (!anAttributePane)
-      continue;
-    aPresentation = Handle(AIS_InteractiveObject)::DownCast (anAttributePane->GetPresentation (anAttribute));
-    if (aPresentation.IsNull())
-      continue;
-
-    thePresentations.Append (aPresentation);
+    Handle(AIS_InteractiveObject) aPresentation = findPresentationImpl (anIndex);
+    if (!aPresentation.IsNull())
+      thePresentations.Append (aPresentation);
   }
 }
 
+// =======================================================================
+// function : findPresentationImpl
+// purpose :
+// =======================================================================
+Handle(AIS_InteractiveObject) DFBrowser_Window::findPresentationImpl (const QModelIndex& theIndex)
+{
+  // the pane may rebuild the presentation geometry on each request, so the created
+  // presentations are cached by the item pointer until the tree model is rebuilt
+  QHash<void*, Handle(AIS_InteractiveObject)>::const_iterator aCachedIt =
+    myPresentationCache.constFind (theIndex.internalPointer());
+  if (aCachedIt != myPresentationCache.constEnd())
+    return aCachedIt.value();
+
+  Handle(AIS_InteractiveObject) aPresentation;
+  Handle(TDF_Attribute) anAttribute = myModule->FindAttribute (theIndex);
+  if (anAttribute.IsNull())
+    return aPresentation;
+  DFBrowserPane_AttributePaneAPI* anAttributePane = myModule->GetAttributePane (anAttribute);
+  if (!anAttributePane)
+    return aPresentation;
+  aPresentation = Handle(AIS_InteractiveObject)::DownCast (anAttributePane->GetPresentation (anAttribute));
+  myPresentationCache.insert (theIndex.internalPointer(), aPresentation);
+  return aPresentation;
+}
+
 // =======================================================================
 // function : updatePropertyPanelWidget
 // purpose :
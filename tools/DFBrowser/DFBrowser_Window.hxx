@@ -27,15 +27,19 @@
 
 #include <Standard_WarningsDisable.hxx>
 #include <QObject>
+#include <QHash>
 #include <QItemSelection>
 #include <QMainWindow>
 #include <QModelIndexList>
+#include <QTimer>
 #include <Standard_WarningsRestore.hxx>
 
 class DFBrowser_DumpView;
 class DFBrowser_Module;
+class DFBrowser_OpenFileThread;
 class DFBrowser_PropertyPanel;
 class DFBrowser_TreeLevelLine;
+class DFBrowser_TreeModel;
 
 class ViewControl_MessageDialog;
 class ViewControl_PropertyView;
@@ -138,14 +142,27 @@ private slots:
   //! Collapses all levels for all selected items
   void onCollapseAll();
 
-  //! Setting flag whether DumpJSon should be applied to build tree model items structure 
+  //! Setting flag whether DumpJSon should be applied to build tree model items structure
   void onUseDumpJson();
 
-  //! Updates all controls by changed selection in OCAF tree view
+  //! Installs the application opened by the file thread into the module and the tree model
+  void onOpenFileFinished();
+
+  //! Dispatches the tree view selection change to the tree level line, the dump view
+  //! and onTreeViewSelectionChanged by direct calls
+  //! \param theSelected list of selected tree view items
+  //! \param theDeselected list of deselected tree view items
+  void onModelSelectionChanged (const QItemSelection& theSelected, const QItemSelection& theDeselected);
+
+  //! Accumulates the selection change and schedules onProcessTreeViewSelectionChanged.
+  //! A burst of selection changes (e.g. clear and select) is processed only once.
   //! \param theSelected list of selected tree view items
   //! \param theDeselected list of deselected tree view items
   void onTreeViewSelectionChanged (const QItemSelection& theSelected, const QItemSelection& theDeselected);
 
+  //! Updates all controls by the selection changes accumulated in onTreeViewSelectionChanged
+  void onProcessTreeViewSelectionChanged();
+
   //! Changes attribute pane stack content depending on search control text
   void onSearchActivated();
 
@@ -187,11 +204,11 @@ private:
   //! \param theModel a model
   void setOCAFModel (QAbstractItemModel* theModel);
 
-  //! Sets expanded levels in OCAF tree view. Do recursive expand of items.
-  //! \param theTreeView an OCAF tree view
-  //! \param theParentIndex an index which children should be expanded
-  //! \param theLevels a number of levels to be expanded, or -1 for all levels
-  static void setExpandedLevels (QTreeView* theTreeView, const QModelIndex& theParentIndex, const int theLevels);
+  //! Selects the OCAF tree view item by the selected names of the plugin parameters
+  //! if they are defined, then removes the names from the parameters.
+  //! Called from UpdateContent(), or from onOpenFileFinished() when the model was
+  //! still empty in UpdateContent() because the file was being opened in the background.
+  void restoreParameterSelection();
 
   //! Marks items highlighted in OCAF tree view model and move view scroll to the first item
   //! \param theIndices a container of OCAF tree view model indices
@@ -213,12 +230,19 @@ protected:
   //! \return container of presentations or NULL
   void findPresentations (const QModelIndexList& theIndices, AIS_ListOfInteractive& thePresentations);
 
+  //! Returns presentation for the OCAF tree model index, using the presentation cache.
+  //! It is the single-index implementation shared by findPresentation and findPresentations.
+  //! \param theIndex a model index
+  //! \return presentation or NULL
+  Handle(AIS_InteractiveObject) findPresentationImpl (const QModelIndex& theIndex);
+
   //! Updates content of Property Panel dock widget. It contains button to activate DumpJson or view with content of it.
   void updatePropertyPanelWidget();
 
 private:
 
   DFBrowser_Module* myModule; //!< current module
+  DFBrowser_TreeModel* myOCAFTreeModel; //!< the OCAF tree view model, kept typed to avoid a cast on each access
   QWidget* myParent; //!< widget, comes when Init window, the window control lays in the layout, updates window title
   QMainWindow* myMainWindow; //!< main control for all components
   DFBrowser_TreeLevelLine* myTreeLevelLine; //!< navigate line of tree levels to the selected item
@@ -232,6 +256,13 @@ private:
   ViewControl_MessageDialog* myExportToShapeViewDialog; //!< dialog about exporting TopoDS_Shape to ShapeView plugin
   Handle(TInspectorAPI_PluginParameters) myParameters; //!< contains application, context, files that should be opened
   QString myOpenedFileName; //!< cached name of opened file between parent is set, apply it by parent setting and nullify
+  DFBrowser_OpenFileThread* myOpenFileThread; //!< thread opening an OCAF application for a file outside of the GUI thread
+  TCollection_AsciiString myOpenedFilePath; //!< path of the successfully opened file, empty if opening failed
+  //! cache of pane presentations by the tree model item pointer, cleared when the tree model is rebuilt
+  QHash<void*, Handle(AIS_InteractiveObject)> myPresentationCache;
+  QTimer mySelectionProcessTimer; //!< zero interval single shot timer to coalesce bursts of tree selection changes
+  QItemSelection mySelectedAccumulated; //!< selection accumulated until mySelectionProcessTimer is processed
+  QItemSelection myDeselectedAccumulated; //!< deselection accumulated until mySelectionProcessTimer is processed
 };
 
 #endif
@@ -24,6 +24,7 @@
 #include <inspector/DFBrowserPane_Tools.hxx>
 
 #include <TDF_Label.hxx>
+#include <TDF_Tool.hxx>
 
 #include <TNaming_DataMapIteratorOfDataMapOfShapePtrRefShape.hxx>
 #include <TNaming_NamedShape.hxx>
@@ -41,6 +42,9 @@
 #include <QWidget>
 #include <Standard_WarningsRestore.hxx>
 
+#include <algorithm>
+
+const int COLUMN_COUNT = 4;
 const int COLUMN_TYPE_WIDTH = 70;
 const int COLUMN_POINTER_WIDTH = 90;
 const int COLUMN_REFERENCE_WIDTH = 90;
@@ -50,9 +54,13 @@ const int COLUMN_REFERENCE_WIDTH = 90;
 // purpose :
 // =======================================================================
 DFBrowserPane_TNamingUsedShapes::DFBrowserPane_TNamingUsedShapes()
-: DFBrowserPane_AttributePane()
+: DFBrowserPane_AttributePane(), myRefsCacheHead (0)
 {
-  getPaneModel()->SetColumnCount (4);
+  std::fill (myRefsCacheKeys, myRefsCacheKeys + REFS_CACHE_SIZE, (const TDF_Attribute*)0);
+  std::fill (myRefsCacheValues, myRefsCacheValues + REFS_CACHE_SIZE,
+             (const ReferenceList*)0);
+
+  getPaneModel()->SetColumnCount (COLUMN_COUNT);
   getPaneModel()->SetItalicColumns (QList<int>());
 
   QList<QVariant> aValues;
@@ -70,8 +78,10 @@ void DFBrowserPane_TNamingUsedShapes::GetValues (const Handle(TDF_Attribute)& th
   if (anAttribute.IsNull())
     return;
 
-  std::list<TCollection_AsciiString> aReferences;
   TNaming_DataMapOfShapePtrRefShape& aMap = anAttribute->Map();
+  // one cell per column is appended per shape of the map, reserved at once to avoid
+  // reallocations of the container while it grows
+  theValues.reserve (theValues.size() + aMap.Extent() * COLUMN_COUNT);
   for (TNaming_DataMapIteratorOfDataMapOfShapePtrRefShape aRefIt (aMap); aRefIt.More(); aRefIt.Next())
   {
     TopoDS_Shape aShape = aRefIt.Key();
@@ -126,15 +136,128 @@ void DFBrowserPane_TNamingUsedShapes::GetAttributeReferences (const Handle(TDF_A
   if (aSelectedEntries.isEmpty())
     return;
 
+  // the selected labels are resolved by entry from the sorted references of the
+  // attribute, materialized on the first request instead of iterating the whole
+  // shapes map of the attribute on each call
+  const ReferenceList* aCachedRefs = findRefs (theAttribute.get());
+  if (!aCachedRefs)
+    aCachedRefs = buildRefs (theAttribute);
+  if (!aCachedRefs)
+    return;
+
+  for (size_t aRefId = 0, aRefCount = aCachedRefs->EntryStrings.size(); aRefId < aRefCount; aRefId++)
+  {
+    if (!aSelectedEntries.contains (aCachedRefs->EntryStrings[aRefId]))
+      continue;
+    TDF_Label aLabel;
+    TDF_Tool::Label (anAttribute->Label().Data(), aCachedRefs->Entries[aRefId], aLabel);
+    Handle(TNaming_NamedShape) aNamedShape;
+    if (!aLabel.IsNull() && aLabel.FindAttribute (TNaming_NamedShape::GetID(), aNamedShape))
+      theRefAttributes.Append (aNamedShape);
+  }
+}
+
+// =======================================================================
+// function : SetSortedReferences
+// purpose :
+// =======================================================================
+void DFBrowserPane_TNamingUsedShapes::SetSortedReferences (NCollection_DataMap<Handle(TDF_Attribute),
+                                                           std::vector<TCollection_AsciiString> >& theAttributeRefs)
+{
+  ClearSortedReferences();
+  for (NCollection_DataMap<Handle(TDF_Attribute), std::vector<TCollection_AsciiString> >::Iterator
+       aRefIt (theAttributeRefs); aRefIt.More(); aRefIt.Next())
+  {
+    // the view form of each entry is converted once here, the repaint requests
+    // compare the prepared QString values without converting
+    ReferenceList& aRefs = myAttributeRefs[aRefIt.Key().get()];
+    aRefs.EntryStrings.reserve (aRefIt.Value().size());
+    for (std::vector<TCollection_AsciiString>::const_iterator anEntryIt = aRefIt.Value().begin();
+         anEntryIt != aRefIt.Value().end(); anEntryIt++)
+    {
+      aRefs.EntryStrings.push_back (QString (anEntryIt->ToCString()));
+    }
+    aRefs.Entries = std::move (aRefIt.ChangeValue());
+  }
+  theAttributeRefs.Clear();
+}
+
+// =======================================================================
+// function : ClearSortedReferences
+// purpose :
+// =======================================================================
+void DFBrowserPane_TNamingUsedShapes::ClearSortedReferences()
+{
+  if (myAttributeRefs.empty())
+    return;
+
+  myAttributeRefs.clear();
+  std::fill (myRefsCacheKeys, myRefsCacheKeys + REFS_CACHE_SIZE, (const TDF_Attribute*)0);
+  std::fill (myRefsCacheValues, myRefsCacheValues + REFS_CACHE_SIZE,
+             (const ReferenceList*)0);
+  myRefsCacheHead = 0;
+}
+
+// =======================================================================
+// function : findRefsImpl
+// purpose :
+// =======================================================================
+const DFBrowserPane_TNamingUsedShapes::ReferenceList* DFBrowserPane_TNamingUsedShapes::findRefsImpl
+  (const TDF_Attribute* theAttribute)
+{
+  for (int aCacheId = 0; aCacheId < REFS_CACHE_SIZE; aCacheId++)
+  {
+    if (myRefsCacheKeys[aCacheId] == theAttribute)
+      return myRefsCacheValues[aCacheId];
+  }
+
+  AttributeRefsMap::const_iterator aMapIt = myAttributeRefs.find (theAttribute);
+  if (aMapIt == myAttributeRefs.end())
+    return 0;
+  const ReferenceList* aRefs = &aMapIt->second;
+
+  const int aCacheId = myRefsCacheHead;
+  myRefsCacheHead = (myRefsCacheHead + 1) % REFS_CACHE_SIZE;
+  myRefsCacheKeys[aCacheId] = theAttribute;
+  myRefsCacheValues[aCacheId] = aRefs;
+  return aRefs;
+}
+
+// =======================================================================
+// function : buildRefs
+// purpose :
+// =======================================================================
+const DFBrowserPane_TNamingUsedShapes::ReferenceList* DFBrowserPane_TNamingUsedShapes::buildRefs
+  (const Handle(TDF_Attribute)& theAttribute)
+{
+  Handle(TNaming_UsedShapes) anAttribute = Handle(TNaming_UsedShapes)::DownCast (theAttribute);
+  if (anAttribute.IsNull())
+    return 0;
+
+  std::vector<TCollection_AsciiString> aReferences;
+  aReferences.reserve (anAttribute->Map().Extent());
   for (TNaming_DataMapIteratorOfDataMapOfShapePtrRefShape aRefIt (anAttribute->Map()); aRefIt.More(); aRefIt.Next())
   {
     TNaming_PtrRefShape aPtrRefShape = aRefIt.Value();
-    if (!aPtrRefShape || !aPtrRefShape->FirstUse())
-      continue;
+    if (aPtrRefShape && aPtrRefShape->FirstUse())
+      aReferences.push_back (DFBrowserPane_Tools::GetEntry (aPtrRefShape->Label()));
+  }
+  std::sort (aReferences.begin(), aReferences.end());
+  // several shapes of the map may be first used on the same label; after sorting the
+  // duplicated entries are adjacent and only one copy of each entry is kept
+  aReferences.erase (std::unique (aReferences.begin(), aReferences.end()), aReferences.end());
 
-    if (aSelectedEntries.contains (DFBrowserPane_Tools::GetEntry (aPtrRefShape->Label()).ToCString()))
-      theRefAttributes.Append (aPtrRefShape->NamedShape());
+  // the view form of each entry is converted once here, the repaint requests
+  // compare the prepared QString values without converting
+  ReferenceList& aRefs = myAttributeRefs[theAttribute.get()];
+  aRefs.EntryStrings.reserve (aReferences.size());
+  for (std::vector<TCollection_AsciiString>::const_iterator anEntryIt = aReferences.begin();
+       anEntryIt != aReferences.end(); anEntryIt++)
+  {
+    aRefs.EntryStrings.push_back (QString (anEntryIt->ToCString()));
   }
+  aRefs.Entries = std::move (aReferences);
+  return &aRefs;
 }
 
 // =======================================================================
@@ -18,9 +18,17 @@
 
 #include <inspector/DFBrowserPane_AttributePane.hxx>
 
+#include <NCollection_DataMap.hxx>
 #include <Standard.hxx>
 #include <TCollection_AsciiString.hxx>
 
+#include <Standard_WarningsDisable.hxx>
+#include <QString>
+#include <Standard_WarningsRestore.hxx>
+
+#include <unordered_map>
+#include <vector>
+
 class QWidget;
 
 //! \class DFBrowserPane_TNamingUsedShapes
@@ -29,6 +37,19 @@ class DFBrowserPane_TNamingUsedShapes : public DFBrowserPane_AttributePane
 {
 public:
 
+  //! reference entries of one attribute, kept as two parallel vectors instead of a
+  //! vector of pairs: requests linearly scan the view forms for selection membership
+  //! and only touch the ascii entry of a matched position to resolve its label, so
+  //! the scanned strings stay contiguous without the cold entries interleaved
+  struct ReferenceList
+  {
+    std::vector<TCollection_AsciiString> Entries; //!< label entries of the references
+    std::vector<QString> EntryStrings; //!< the same entries as strings of the view, converted at build time
+  };
+
+  //! container type of sorted reference entries by raw attribute pointer
+  typedef std::unordered_map<const TDF_Attribute*, ReferenceList> AttributeRefsMap;
+
   //! Constructor
   Standard_EXPORT DFBrowserPane_TNamingUsedShapes();
 
@@ -55,11 +76,66 @@ public:
                                       NCollection_List<Handle(TDF_Attribute)>& theRefAttributes,
                                       Handle(Standard_Transient)& theRefPresentation) Standard_OVERRIDE;
 
+  //! Sets sorted label entries of the attribute references, to be used instead of
+  //! iterating the whole shapes map of the attribute on each request.
+  //! The reference lists are moved out of the argument, it is cleared on return.
+  //! \param theAttributeRefs container of sorted references by attribute, consumed by the call
+  Standard_EXPORT void SetSortedReferences (NCollection_DataMap<Handle(TDF_Attribute),
+                                            std::vector<TCollection_AsciiString> >& theAttributeRefs);
+
+  //! Clears the container of sorted references
+  Standard_EXPORT void ClearSortedReferences();
+
+  //! Returns the container of sorted references without copying, to let the callers
+  //! iterate the entries directly
+  const AttributeRefsMap& SortedReferences() const { return myAttributeRefs; }
+
+private:
+
+  //! Returns sorted references of the attribute or NULL if they are not cached.
+  //! A small most-recently-used cache of raw attribute pointers is probed before
+  //! the map: repaints request the same attribute repeatedly, so most lookups
+  //! are resolved without a map probe.
+  //! The raw pointer is taken directly: it is the container key and the callers hold
+  //! the attribute Handle for the duration of the call.
+  //! \param theAttribute a current attribute
+  const ReferenceList* findRefs (const TDF_Attribute* theAttribute)
+  {
+    // inlined fast path: when no sorted references were set, the callers fall back
+    // to the live attribute map without a call into the lookup
+    return myAttributeRefs.empty() ? 0 : findRefsImpl (theAttribute);
+  }
+
+  //! Out-of-line part of findRefs: probes the most-recently-used slots, then the container
+  //! \param theAttribute a current attribute
+  const ReferenceList* findRefsImpl (const TDF_Attribute* theAttribute);
+
+  //! Builds the sorted reference entries of the attribute and memoizes them in the
+  //! container. The references are materialized on the first request per attribute,
+  //! attributes that are never visited do not pay the build.
+  //! \param theAttribute a current attribute, expected to be TNaming_UsedShapes
+  //! \return the built references or NULL if the attribute kind is unexpected
+  const ReferenceList* buildRefs (const Handle(TDF_Attribute)& theAttribute);
+
 protected:
   //! Defines widths of table columns
   //! \return container of widths
   Standard_EXPORT virtual QMap<int, int> getTableColumnWidths() const Standard_OVERRIDE;
 
+private:
+
+  enum { REFS_CACHE_SIZE = 8 };
+
+  //! container of sorted references by raw attribute pointer; the pointer key avoids
+  //! Handle copies on each probe, the attributes are owned by the document while the
+  //! container is filled.
+  //! The entry strings allocate their buffers through Standard::Allocate and cannot be
+  //! placed into an arena without changing the string type; the vector keeps the
+  //! per-attribute entries contiguous instead.
+  AttributeRefsMap myAttributeRefs;
+  const TDF_Attribute* myRefsCacheKeys[REFS_CACHE_SIZE]; //!< recently requested attributes
+  const ReferenceList* myRefsCacheValues[REFS_CACHE_SIZE]; //!< references of the recently requested attributes
+  int myRefsCacheHead; //!< position of the next most-recently-used cache insertion
 };
 
 #endif
@@ -259,8 +259,21 @@ QModelIndexList TreeModel_ModelBase::Selected (const QModelIndexList& theIndices
 QModelIndex TreeModel_ModelBase::SingleSelected (const QModelIndexList& theIndices, const int theCellId,
                                                  const Qt::Orientation theOrientation)
 {
-  QModelIndexList aSelected = Selected (theIndices, theCellId, theOrientation);
-  return aSelected.size() == 1 ? aSelected.first() : QModelIndex();
+  // single pass with an early exit on the second matched index, the intermediate
+  // list of Selected() is not built
+  QModelIndex aFoundIndex;
+  for (QModelIndexList::const_iterator anIndicesIt = theIndices.begin(); anIndicesIt != theIndices.end(); anIndicesIt++)
+  {
+    const QModelIndex& anIndex = *anIndicesIt;
+    if ((theOrientation == Qt::Horizontal && anIndex.column() == theCellId) ||
+        (theOrientation == Qt::Vertical && anIndex.row() == theCellId))
+    {
+      if (aFoundIndex.isValid())
+        return QModelIndex(); // more than one selected
+      aFoundIndex = anIndex;
+    }
+  }
+  return aFoundIndex;
 }
 
 // =======================================================================
@@ -24,7 +24,9 @@
 #include <QFont>
 #include <QFontMetrics>
 #include <QHeaderView>
+#include <QList>
 #include <QObject>
+#include <QPair>
 #include <QRegExp>
 #include <QStringList>
 #include <QStyle>
@@ -234,9 +236,21 @@ void TreeModel_Tools::SetExpanded (QTreeView* theTreeView, const QModelIndex& th
     theLevels--;
 
   QAbstractItemModel* aModel = theTreeView->model();
+  // iterative depth-first processing: each element keeps the index and the levels left under it,
+  // it avoids recursion depth limits and repeated rowCount calls on the way back
+  QList<QPair<QModelIndex, int> > aStack;
   for (int aRowId = 0, aRows = aModel->rowCount (theIndex); aRowId < aRows; aRowId++)
+    aStack.append (qMakePair (aModel->index (aRowId, 0, theIndex), theLevels));
+
+  while (!aStack.isEmpty())
   {
-    int aLevels = theLevels;
-    SetExpanded (theTreeView, aModel->index (aRowId, 0, theIndex), isExpanded, aLevels);
+    QPair<QModelIndex, int> anElement = aStack.takeLast();
+    if (anElement.second != -1 && anElement.second <= 0)
+      continue;
+
+    theTreeView->setExpanded (anElement.first, isExpanded);
+    int aLevels = anElement.second != -1 ? anElement.second - 1 : -1;
+    for (int aRowId = 0, aRows = aModel->rowCount (anElement.first); aRowId < aRows; aRowId++)
+      aStack.append (qMakePair (aModel->index (aRowId, 0, anElement.first), aLevels));
   }
 }